@@ -0,0 +1,49 @@
+#pragma once
+
+#include <span>
+#include <stdexcept>
+
+#include "BitboardEvaluator.hpp"
+#include "Board.hpp"
+
+// Scores many positions per call with the ClassicSolver heuristic. Positions are passed as two parallel
+// arrays (structure of arrays) holding the evaluated side's and the opponent's discs, and each lane is
+// scored by BitboardEvaluator straight from its two bitboards.
+template<short Rows = 6, short Columns = 7, short Connect = 4>
+class BatchEvaluator {
+	using BoardType = BasicBoard<Rows, Columns, Connect>;
+public:
+	using Bitboard = typename BoardType::Bitboard;
+
+	//------------------------------------------------- CTOR SECTION -------------------------------------------------//
+
+	BatchEvaluator() = delete;
+
+	//--------------------------------------------- METHOD SECTION ---------------------------------------------------//
+
+	// Splits `boards` into the discs of `playerSymbol` and of the other side.
+	static void Gather(const std::span<const BoardType> boards, const char playerSymbol,
+		const std::span<Bitboard> players, const std::span<Bitboard> opponents) {
+		if (players.size() != boards.size() || opponents.size() != boards.size()) {
+			throw std::length_error("Batch arrays must have one lane per board.");
+		}
+
+		const auto opponentSymbol = playerSymbol == PlayerSymbol::FIRST ? PlayerSymbol::SECOND : PlayerSymbol::FIRST;
+		for (size_t i = 0; i < boards.size(); ++i) {
+			players[i]   = boards[i].GetDiscs(playerSymbol);
+			opponents[i] = boards[i].GetDiscs(opponentSymbol);
+		}
+	}
+
+	// scores[i] = ClassicSolver score of the position with discs players[i] and opponents[i].
+	static void Evaluate(const std::span<const Bitboard> players, const std::span<const Bitboard> opponents,
+		const std::span<int> scores) {
+		if (opponents.size() != players.size() || scores.size() != players.size()) {
+			throw std::length_error("Batch arrays must have the same number of lanes.");
+		}
+
+		for (size_t i = 0; i < players.size(); ++i) {
+			scores[i] = BitboardEvaluator<Rows, Columns, Connect>::Evaluate(players[i], opponents[i]);
+		}
+	}
+};
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+
+#include "Board.hpp"
+#include "Evaluation.hpp"
+
+// ClassicSolver heuristic computed from the two disc bitboards alone. Along each direction, the
+// windows are named by their lowest cell; shifting the discs by 0 .. Connect - 1 steps lines every
+// window's cells up on that bit, a bit-sliced adder counts them, and a popcount of the windows with
+// a given count and no opponent disc replaces the per-window branches of ScoreWindow.
+template<short Rows = 6, short Columns = 7, short Connect = 4>
+class BitboardEvaluator {
+	using BoardType = BasicBoard<Rows, Columns, Connect>;
+public:
+	using Bitboard = typename BoardType::Bitboard;
+
+	//------------------------------------------------- CTOR SECTION -------------------------------------------------//
+
+	BitboardEvaluator() = delete;
+
+	//--------------------------------------------- METHOD SECTION ---------------------------------------------------//
+
+	[[nodiscard]] static int Evaluate(const BoardType& board, const char playerSymbol) {
+		const auto opponentSymbol = playerSymbol == PlayerSymbol::FIRST ? PlayerSymbol::SECOND : PlayerSymbol::FIRST;
+
+		return BitboardEvaluator::Evaluate(board.GetDiscs(playerSymbol), board.GetDiscs(opponentSymbol));
+	}
+
+	// Score of `player`'s discs against `opponent`'s.
+	[[nodiscard]] static int Evaluate(const Bitboard player, const Bitboard opponent) {
+		auto score = 0;
+
+		for (size_t i = 0; i < BitboardEvaluator::BONUS_GROUPS.count; ++i) {
+			const auto& [mask, playerBonus, opponentBonus] = BitboardEvaluator::BONUS_GROUPS.groups[i];
+
+			score += bitboard::Popcount(player & mask) * playerBonus + bitboard::Popcount(opponent & mask) * opponentBonus;
+		}
+
+		const auto playerWindows   = BitboardEvaluator::CountOpenWindows(player, opponent);
+		const auto opponentWindows = BitboardEvaluator::CountOpenWindows(opponent, player);
+
+		for (size_t tier = 0; tier < TIERS; ++tier) {
+			const auto discs = Connect - static_cast<int>(tier);
+
+			score += playerWindows[tier] * evaluation::WINDOW_SCORES<Connect>[discs][0];
+			score += opponentWindows[tier] * evaluation::WINDOW_SCORES<Connect>[0][discs];
+		}
+
+		return score;
+	}
+
+private:
+	// Windows with Connect, Connect - 1 and Connect - 2 discs of one side and the rest empty.
+	static constexpr size_t TIERS = 3;
+
+	// Only those windows score; a weight anywhere else in the table would be missed here.
+	static_assert([] {
+		for (auto playerCount = 0; playerCount <= Connect; ++playerCount) {
+			for (auto opponentCount = 0; playerCount + opponentCount <= Connect; ++opponentCount) {
+				const auto isTier = (opponentCount == 0 && playerCount > 0 && playerCount + static_cast<int>(TIERS) > Connect)
+					|| (playerCount == 0 && opponentCount > 0 && opponentCount + static_cast<int>(TIERS) > Connect);
+
+				if (!isTier && evaluation::WINDOW_SCORES<Connect>[playerCount][opponentCount] != 0) {
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}(), "Window weights outside the scored tiers are not supported.");
+
+	// Bits of a bit-sliced disc counter, enough for 0 .. Connect.
+	static constexpr size_t COUNTER_BITS = std::bit_width(static_cast<unsigned>(Connect));
+
+	// Lowest cells of the windows that fit on the board, per direction.
+	static constexpr auto WINDOW_STARTS = [] {
+		std::array<Bitboard, BoardType::DIRECTIONS.size()> starts{};
+
+		for (size_t direction = 0; direction < BoardType::DIRECTIONS.size(); ++direction) {
+			starts[direction] = BoardType::BOARD_MASK;
+			for (short k = 1; k < Connect; ++k) {
+				starts[direction] &= BoardType::BOARD_MASK >> k * BoardType::DIRECTIONS[direction];
+			}
+		}
+
+		return starts;
+	}();
+
+	struct BonusGroup {
+		Bitboard mask;
+		int playerBonus;
+		int opponentBonus;
+	};
+
+	struct BonusGroups {
+		std::array<BonusGroup, Columns> groups{};
+		size_t count = 0;
+	};
+
+	// Columns sharing the same evaluation::COLUMN_BONUSES, merged into one mask each.
+	static constexpr auto BONUS_GROUPS = [] {
+		BonusGroups result{};
+
+		for (short column = 0; column < Columns; ++column) {
+			const auto& [playerBonus, opponentBonus] = evaluation::COLUMN_BONUSES<Columns>[column];
+
+			auto group = size_t{ 0 };
+			while (group < result.count
+				&& (result.groups[group].playerBonus != playerBonus || result.groups[group].opponentBonus != opponentBonus)) {
+				++group;
+			}
+
+			if (group == result.count) {
+				result.groups[result.count++] = { Bitboard{ 0 }, playerBonus, opponentBonus };
+			}
+			result.groups[group].mask |= BoardType::GetColumnMask(column);
+		}
+
+		return result;
+	}();
+
+	// Per tier, the windows along all directions holding exactly Connect - tier discs of `own` and none of `other`.
+	[[nodiscard]] static std::array<int, TIERS> CountOpenWindows(const Bitboard own, const Bitboard other) {
+		std::array<int, TIERS> counts{};
+
+		for (size_t direction = 0; direction < BoardType::DIRECTIONS.size(); ++direction) {
+			const auto shift = BoardType::DIRECTIONS[direction];
+
+			auto open = BitboardEvaluator::WINDOW_STARTS[direction];
+			std::array<Bitboard, COUNTER_BITS> sum{};
+
+			for (short k = 0; k < Connect; ++k) {
+				open &= ~(other >> k * shift);
+
+				auto carry = own >> k * shift;
+				for (auto& bit : sum) {
+					const auto next = bit & carry;
+					bit  ^= carry;
+					carry = next;
+				}
+			}
+
+			for (size_t tier = 0; tier < TIERS; ++tier) {
+				auto matches = open;
+				for (size_t bit = 0; bit < COUNTER_BITS; ++bit) {
+					matches &= (Connect - tier) >> bit & 1 ? sum[bit] : ~sum[bit];
+				}
+
+				counts[tier] += bitboard::Popcount(matches);
+			}
+		}
+
+		return counts;
+	}
+};
@@ -3,63 +3,238 @@
     #define NOMINMAX
 #endif
 
+// Bounds-checks GetCellUnchecked as well as GetCell; on by default in debug builds.
+#if !defined(BOARD_CHECKED_ACCESS) && !defined(NDEBUG)
+    #define BOARD_CHECKED_ACCESS
+#endif
+
+#include <algorithm>
 #include <array>
-#include <functional>
-#include <numeric>
+#include <cstddef>
+#include <cstdint>
+#include <span>
 #include <stdexcept>
+#include <string_view>
+#include <utility>
 #include <vector>
-#include <deque>
 
 #include "Enums.hpp"
 #include "Utils.hpp"
+#include "WideBitboard.hpp"
 
 #include "include/fmt/color.h"
 
-class Board {
+// `Connect` is the number of discs in a row that wins the game.
+template<short Rows = 6, short Columns = 7, short Connect = 4>
+class BasicBoard {
+	static_assert(Rows > 0 && Columns > 0, "Board must have at least one cell.");
+	static_assert(Columns <= 32, "Playable columns must fit into a 32-bit mask.");
+	static_assert(Rows < 64, "A column code must fit into 64 bits.");
+	static_assert(Connect >= 2, "A line must have at least two cells.");
+	static_assert((Rows + 1) * Columns > 64 || (Connect - 1) * (Rows + 2) < 64,
+		"Line shifts must stay within the bitboard.");
+
 public:
+    // Size of the binary form written by Serialize: the exact position code, little-endian.
+    static constexpr size_t SERIALIZED_SIZE = 8;
+
+    // Column-major bitboards: column c occupies bits [c * (rows + 1), c * (rows + 1) + rows),
+    // bottom cell first, with one spare sentinel bit on top of every column. Layouts of more than
+    // 64 bits (8x8, 9x7, 10x8, ...) use a WideBitboard with the same operators.
+    using Bitboard = bitboard::Fitting<(Rows + 1) * Columns>;
+
+    // Every cell of the board, sentinel bits excluded.
+    static constexpr Bitboard BOARD_MASK = [] {
+        auto mask = Bitboard{ 0 };
+        for (short column = 0; column < Columns; ++column) {
+            mask |= ((Bitboard{ 1 } << Rows) - 1) << column * (Rows + 1);
+        }
+
+        return mask;
+    }();
+
+    // Bit distances between neighbours: vertical, horizontal and the two diagonals.
+    static constexpr std::array<int, 4> DIRECTIONS{ 1, Rows + 1, Rows, Rows + 2 };
+
+    // One history entry packed into a byte: the column in the low five bits, whether its bottom disc
+    // was popped out (PopOut) instead of a disc being dropped, and whose disc it was; enough to undo
+    // either kind of move in O(1).
+    class MoveRecord {
+    public:
+        constexpr MoveRecord() = default;
+
+        constexpr MoveRecord(const short column, const bool isPop, const bool isFirst)
+            : bits_(static_cast<uint8_t>(column | isPop << COLUMN_BITS | isFirst << (COLUMN_BITS + 1))) {}
+
+        [[nodiscard]] constexpr short GetColumn() const {
+            return static_cast<short>(this->bits_ & ((1 << COLUMN_BITS) - 1));
+        }
+
+        [[nodiscard]] constexpr bool IsPop() const {
+            return this->bits_ >> COLUMN_BITS & 1;
+        }
+
+        [[nodiscard]] constexpr bool IsFirst() const {
+            return this->bits_ >> (COLUMN_BITS + 1) & 1;
+        }
+
+        friend constexpr bool operator==(const MoveRecord&, const MoveRecord&) = default;
+
+    private:
+        // Enough for the 32 columns the playable mask allows.
+        static constexpr int COLUMN_BITS = 5;
+
+        uint8_t bits_ = 0;
+    };
+
     //------------------------------------------------- CTOR SECTION -------------------------------------------------//
 
-    explicit Board() {
-        this->field_.assign(this->rowsCount_ * this->columnsCount_, ' ');
-		this->field_.shrink_to_fit();
+    explicit BasicBoard() = default;
+
+    BasicBoard(const BasicBoard&) = default;
+    BasicBoard(BasicBoard&&) noexcept = default;
+
+    // Replays 1-based columns such as "4453" or "4 4 5 3", alternating symbols from `firstSymbol`; a
+    // 'p' before a column pops its bottom disc out instead (PopOut), as in "4 4 p4", the form Game writes.
+    // Up to 9 columns every digit is a move; wider boards need moves separated by spaces.
+    // Fails on anything but digits, 'p' and spaces, on illegal moves and on moves after a win.
+    [[nodiscard]] static bool TryFromMoves(const std::string_view moves, BasicBoard& result,
+        const char firstSymbol = PlayerSymbol::FIRST) {
+        const char secondSymbol = firstSymbol == PlayerSymbol::FIRST ? PlayerSymbol::SECOND : PlayerSymbol::FIRST;
+
+        BasicBoard board;
+        auto isOver      = false;
+        auto isFirstTurn = true;
+
+        for (size_t i = 0; i < moves.size();) {
+            if (moves[i] == ' ') {
+                ++i;
+                continue;
+            }
+
+            const auto isPop = moves[i] == 'p';
+            i += isPop;
+
+            auto column = 0;
+            do {
+                if (i == moves.size() || moves[i] < '0' || moves[i] > '9' || column > Columns) {
+                    return false;
+                }
+                column = column * 10 + (moves[i++] - '0');
+            } while (Columns > 9 && i < moves.size() && moves[i] != ' ');
+
+            // Pops take discs away, so the disc count no longer tells whose turn it is.
+            const auto symbol = isFirstTurn ? firstSymbol : secondSymbol;
+            const auto move   = static_cast<short>(column - 1);
+            if (isOver || column == 0 || column > Columns
+                || !(isPop ? board.PopMove(move, symbol) : board.MakeMove(move, symbol))) {
+                return false;
+            }
+
+            isOver      = board.GetWinnerCharacter() != '=';
+            isFirstTurn = !isFirstTurn;
+        }
+
+        result = board;
+        return true;
+    }
+
+    // Restores a board written by Serialize. The move history is not stored, so the result has none.
+    [[nodiscard]] static bool TryDeserialize(const std::span<const std::byte, SERIALIZED_SIZE> bytes, BasicBoard& result)
+        requires ((Rows + 1) * Columns <= 64) {
+        auto code = uint64_t{ 0 };
+        for (size_t i = 0; i < SERIALIZED_SIZE; ++i) {
+            code |= static_cast<uint64_t>(bytes[i]) << 8 * i;
+        }
+
+        // A layout of exactly 64 bits has no spare bits to check, and shifting by 64 is undefined.
+        if constexpr ((Rows + 1) * Columns < 64) {
+            if (code >> (Rows + 1) * Columns) {
+                return false;
+            }
+        }
+
+        return BasicBoard::TryFromExactKey(code, result);
+    }
+
+    // Inverse of ToExactKey; fails on codes where a column lacks its marker bit. No history either.
+    [[nodiscard]] static bool TryFromExactKey(const Bitboard code, BasicBoard& result) {
+        constexpr auto columnCode = (Bitboard{ 1 } << (Rows + 1)) - 1;
+
+        BasicBoard board;
+        for (short column = 0; column < Columns; ++column) {
+            const auto columnBits = (code >> column * (Rows + 1)) & columnCode;
+            if (columnBits == 0) {
+                return false;
+            }
+
+            const auto discs = (Bitboard{ 1 } << (bitboard::BitWidth(columnBits) - 1)) - 1;
+            board.mask_      |= discs << column * (Rows + 1);
+            board.firstMask_ |= (columnBits & discs) << column * (Rows + 1);
+        }
+
+        for (short column = 0; column < Columns; ++column) {
+            board.UpdateKeys(column, BasicBoard::EMPTY_COLUMN_CODE);
+        }
+
+        result = board;
+        return true;
+    }
+
+    // Restores `boards.size()` consecutive records; false if the sizes differ or any record is invalid.
+    [[nodiscard]] static bool TryDeserializeBatch(const std::span<const std::byte> bytes, const std::span<BasicBoard> boards)
+        requires ((Rows + 1) * Columns <= 64) {
+        if (bytes.size() != boards.size() * SERIALIZED_SIZE) {
+            return false;
+        }
+
+        for (size_t i = 0; i < boards.size(); ++i) {
+            if (!BasicBoard::TryDeserialize(bytes.subspan(i * SERIALIZED_SIZE).template first<SERIALIZED_SIZE>(), boards[i])) {
+                return false;
+            }
+        }
+
+        return true;
     }
 
-    Board(const Board&) = default;
-    Board(Board&&) noexcept = default;
+    [[nodiscard]] static BasicBoard FromMoves(const std::string_view moves, const char firstSymbol = PlayerSymbol::FIRST) {
+        BasicBoard board;
+        if (!BasicBoard::TryFromMoves(moves, board, firstSymbol)) {
+            throw std::invalid_argument("Illegal move sequence.");
+        }
+
+        return board;
+    }
 
 	//----------------------------------------------- DTOR SECTION ---------------------------------------------------//
 
-	~Board() noexcept = default;
+	~BasicBoard() noexcept = default;
 	
     //--------------------------------------------- OPERATOR SECTION -------------------------------------------------//
 
-    Board& operator=(const Board&) = default;
-    Board& operator=(Board&&) noexcept = default;
+    BasicBoard& operator=(const BasicBoard&) = default;
+    BasicBoard& operator=(BasicBoard&&) noexcept = default;
 
     void ColorPrint(const std::pair<char, char>& playerSymbols) {
-        if (this->field_.empty()) {
-            return;
-        }
-
 		fmt::print("| {} | ", 1);
-		for (auto i = 1; i < this->columnsCount_; ++i) {
+		for (auto i = 1; i < Columns; ++i) {
 			fmt::print("{} | ", i + 1);
 		}
-		fmt::print("\n{}\n", utils::GetDelimiter('-', 4 * this->columnsCount_ + this->columnsCount_ / 7));
+		fmt::print("\n{}\n", utils::GetDelimiter('-', 4 * Columns + Columns / 7));
     	
-        for (auto i = 0; i < this->rowsCount_; ++i) {
+        for (auto i = 0; i < Rows; ++i) {
 
         	fmt::print("| ");
-			Board::ColorPrintCell(this->GetCell(i, 0), playerSymbols);
+			BasicBoard::ColorPrintCell(this->GetCellUnchecked(i, 0), playerSymbols);
         	fmt::print(" | ");
         	
-            for (auto j = 1; j < this->columnsCount_; ++j) {
-				Board::ColorPrintCell(this->GetCell(i, j), playerSymbols);
+            for (auto j = 1; j < Columns; ++j) {
+				BasicBoard::ColorPrintCell(this->GetCellUnchecked(i, j), playerSymbols);
             	fmt::print(" | ");
             }
 
-			fmt::print("\n{}", utils::GetDelimiter('-', 4 * this->columnsCount_ + this->columnsCount_ / 7));
-            if (i != this->rowsCount_ - 1) {
+			fmt::print("\n{}", utils::GetDelimiter('-', 4 * Columns + Columns / 7));
+            if (i != Rows - 1) {
 				fmt::print("\n");
             }
         }
@@ -69,51 +244,83 @@ public:
 
     //-------------------------------------------- ACCESSOR SECTION --------------------------------------------------//
 
-    [[nodiscard]] const auto& GetField() const {
-        return this->field_;
+    [[nodiscard]] std::vector<char> GetField() const {
+        std::vector<char> field;
+        field.reserve(this->GetSize());
+
+        for (short i = 0; i < Rows; ++i) {
+            for (short j = 0; j < Columns; ++j) {
+                field.push_back(this->GetCellUnchecked(i, j));
+            }
+        }
+
+        return field;
     }
 
-    [[nodiscard]] size_t GetSize() const {
-        return this->field_.size();
+    [[nodiscard]] static constexpr size_t GetSize() {
+        return static_cast<size_t>(Rows) * Columns;
     }
 
-    [[nodiscard]] auto GetRowsCount() const {
-        return this->rowsCount_;
+    [[nodiscard]] static constexpr short GetRowsCount() {
+        return Rows;
     }
 
-    [[nodiscard]] auto GetColumnsCount() const {
-        return this->columnsCount_;
+    [[nodiscard]] static constexpr short GetColumnsCount() {
+        return Columns;
     }
 
-    [[nodiscard]] const auto& GetHistory() const {
-        return this->historyMoves_;
+    [[nodiscard]] static constexpr Bitboard GetCellMask(const short row, const short column) {
+        return Bitboard{ 1 } << (Rows - 1 - row + column * (Rows + 1));
+    }
+
+    [[nodiscard]] static constexpr Bitboard GetColumnMask(const short column) {
+        return ((Bitboard{ 1 } << Rows) - 1) << column * (Rows + 1);
+    }
+
+    // Cells holding discs of `character`.
+    [[nodiscard]] Bitboard GetDiscs(const char character) const {
+        return character == PlayerSymbol::FIRST ? this->firstMask_ : this->mask_ ^ this->firstMask_;
+    }
+
+    // Latest moves, oldest first; long PopOut games keep the last GetSize() of them.
+    [[nodiscard]] std::span<const MoveRecord> GetHistory() const {
+        return { this->historyMoves_.data(), this->historySize_ };
     }
 
     //--------------------------------------------- METHOD SECTION ---------------------------------------------------//
 
     [[nodiscard]] short GetLastMove() const {
-        return this->historyMoves_.empty() ? -1 : this->historyMoves_.back();
+        return this->historySize_ == 0 ? -1 : this->historyMoves_[this->historySize_ - 1].GetColumn();
     }
 	
     [[nodiscard]] char GetCell(const short row, const short column) const {
-        if (static_cast<short>(row) >= this->rowsCount_) {
+        if (row < 0 || row >= Rows) {
             throw std::out_of_range("Row index out of boundaries.");
         }
-        if (static_cast<short>(column) >= this->columnsCount_) {
+        if (column < 0 || column >= Columns) {
             throw std::out_of_range("Column index out of boundaries.");
         }
 
-        return this->field_[static_cast<size_t>(row) * this->columnsCount_ + static_cast<size_t>(column)];
+        return this->ReadCell(row, column);
+    }
+
+    // Skips the bounds checks unless BOARD_CHECKED_ACCESS is defined; for internal hot loops.
+    [[nodiscard]] char GetCellUnchecked(const short row, const short column) const {
+#ifdef BOARD_CHECKED_ACCESS
+        return this->GetCell(row, column);
+#else
+        return this->ReadCell(row, column);
+#endif
     }
 
 	template<class OutIter>
 	[[nodiscard]] bool TryGetRow(const short row, OutIter result) const {
-		if (row >= this->rowsCount_) {
+		if (row < 0 || row >= Rows) {
 			return false;
 		}
 		
-		for (auto i = row * this->columnsCount_; i < (row + 1) * this->columnsCount_; ++i) {
-			*result++ = this->field_[i];
+		for (short i = 0; i < Columns; ++i) {
+			*result++ = this->GetCellUnchecked(row, i);
 		}
 
 		return true;
@@ -121,22 +328,46 @@ public:
 
 	template<class OutIter>
 	[[nodiscard]] bool TryGetColumn(const short column, OutIter result) const {
-		if (column >= this->columnsCount_) {
+		if (column < 0 || column >= Columns) {
 			return false;
 		}
         
-		for (short i = column; i < this->GetSize(); i += this->columnsCount_) {
-            *result++ = this->field_[i];
+		for (short i = 0; i < Rows; ++i) {
+            *result++ = this->GetCellUnchecked(i, column);
         }
 	    	
         return true;
     }
 
+	[[nodiscard]] short GetHeight(const short column) const {
+		return static_cast<short>(bitboard::Popcount(this->mask_ & BasicBoard::GetColumnMask(column)));
+	}
+
+	[[nodiscard]] bool CanPlay(const short column) const {
+		return column >= 0 && column < Columns && !(this->mask_ & this->TopMask(column));
+	}
+
+	// Bit c is set when column c can take another disc.
+	[[nodiscard]] uint32_t GetPlayableColumns() const {
+		auto playable = uint32_t{ 0 };
+
+		for (short column = 0; column < Columns; ++column) {
+			playable |= static_cast<uint32_t>(!(this->mask_ & BasicBoard::TopMask(column))) << column;
+		}
+
+		return playable;
+	}
+
+	// PopOut: a player may pop a column whose bottom disc is their own.
+	[[nodiscard]] bool CanPop(const short column, const char character) const {
+		return column >= 0 && column < Columns && (this->GetDiscs(character) & BasicBoard::BottomMask(column));
+	}
+
 	template<class OutIter>
 	bool TryGetAvailableMoves(OutIter result) const {
 		try {
-			for (auto i = 0; i < this->columnsCount_; ++i) {
-				if (this->field_[i] == ' ') {
+			for (auto i = 0; i < Columns; ++i) {
+				if (this->CanPlay(i)) {
 					*result++ = i;
 				}
 			}
@@ -149,16 +380,24 @@ public:
 	}
 
     [[nodiscard]] char GetWinnerCharacter() const {
-        for (const auto& combo : this->WINNING_COMBOS) {
-            const auto temp = std::array{
-                this->GetCell(static_cast<short>(combo[0].first), static_cast<short>(combo[0].second)) != ' ',
-                this->GetCell(static_cast<short>(combo[0].first), static_cast<short>(combo[0].second)) == this->GetCell(static_cast<short>(combo[1].first), static_cast<short>(combo[1].second)),
-                this->GetCell(static_cast<short>(combo[1].first), static_cast<short>(combo[1].second)) == this->GetCell(static_cast<short>(combo[2].first), static_cast<short>(combo[2].second)),
-                this->GetCell(static_cast<short>(combo[2].first), static_cast<short>(combo[2].second)) == this->GetCell(static_cast<short>(combo[3].first), static_cast<short>(combo[3].second))
-            };
-
-            if (std::accumulate(temp.begin(), temp.end(), true, std::bit_and<>())) {
-                return this->GetCell(static_cast<short>(combo.begin()->first), static_cast<short>(combo.begin()->second));
+        const auto* last = this->historySize_ != 0 ? &this->historyMoves_[this->historySize_ - 1] : nullptr;
+
+        if (last != nullptr && !last->IsPop()) {
+            const auto lastCell = this->GetTopCellMask(last->GetColumn());
+
+            if (this->IsAlignedThrough(last->IsFirst() ? this->firstMask_ : this->mask_ ^ this->firstMask_, lastCell)) {
+                return last->IsFirst() ? PlayerSymbol::FIRST : PlayerSymbol::SECOND;
+            }
+        }
+        else if (this->mask_ != 0) {
+            // No last drop to go by (a deserialized position, or a pop that moved a whole column): any
+            // line of either side may be complete. A pop completing lines for both sides wins for the popper.
+            const auto isSecondPopping = last != nullptr && !last->IsFirst();
+
+            for (const auto isFirst : { !isSecondPopping, isSecondPopping }) {
+                if (this->IsAlignedThrough(isFirst ? this->firstMask_ : this->mask_ ^ this->firstMask_, BasicBoard::BOARD_MASK)) {
+                    return isFirst ? PlayerSymbol::FIRST : PlayerSymbol::SECOND;
+                }
             }
         }
 
@@ -170,52 +409,171 @@ public:
     }
 
 	[[nodiscard]] uint64_t ToKey() const {
-		auto seed = this->field_.size();
-    	
-		for (const auto& i : this->field_) {
-			seed ^= i + 2654435769ull + (seed << 6ull) + (seed >> 2ull);
+		return this->key_;
+	}
+
+	// Key of the left-right mirror image, kept up to date together with ToKey().
+	[[nodiscard]] uint64_t ToMirrorKey() const {
+		return this->mirrorKey_;
+	}
+
+	// A position and its left-right mirror image have the same value, so both share this key.
+	[[nodiscard]] uint64_t ToCanonicalKey() const {
+		return std::min(this->key_, this->mirrorKey_);
+	}
+
+	// True when ToCanonicalKey() is the key of the mirror image: moves stored under it are mirrored.
+	[[nodiscard]] bool IsCanonicalMirrored() const {
+		return this->mirrorKey_ < this->key_;
+	}
+
+	// Exact encoding of the position: every column holds its first player's discs under a marker
+	// bit one above its top disc, so distinct positions never share a code (49 bits on 7x6).
+	[[nodiscard]] Bitboard ToExactKey() const {
+		return this->firstMask_ + this->mask_ + BasicBoard::BOTTOM_ROW_MASK;
+	}
+
+	// Exact code of the orientation ToCanonicalKey() describes.
+	[[nodiscard]] Bitboard ToCanonicalExactKey() const {
+		const auto code = this->ToExactKey();
+		if (!this->IsCanonicalMirrored()) {
+			return code;
 		}
-    	
-		return seed;
+
+		constexpr auto columnCode = (Bitboard{ 1 } << (Rows + 1)) - 1;
+
+		auto mirrored = Bitboard{ 0 };
+		for (short column = 0; column < Columns; ++column) {
+			mirrored |= ((code >> column * (Rows + 1)) & columnCode) << BasicBoard::MirrorColumn(column) * (Rows + 1);
+		}
+
+		return mirrored;
+	}
+
+	[[nodiscard]] static constexpr short MirrorColumn(const short column) {
+		return static_cast<short>(Columns - 1 - column);
+	}
+
+	// Moves as single numbers, as solvers return them: a drop is its column, a pop is ToPopMove(column).
+	[[nodiscard]] static constexpr short ToPopMove(const short column) {
+		return static_cast<short>(Columns + column);
+	}
+
+	[[nodiscard]] static constexpr short MirrorMove(const short move) {
+		return move >= Columns ? BasicBoard::ToPopMove(BasicBoard::MirrorColumn(move - Columns)) : BasicBoard::MirrorColumn(move);
+	}
+
+	bool PlayMove(const short move, const char moveSymbol) {
+		return move >= Columns ? this->PopMove(static_cast<short>(move - Columns), moveSymbol) : this->MakeMove(move, moveSymbol);
 	}
 
     bool MakeMove(short column, char moveSymbol) {
-        auto index = static_cast<int>(column);
-        while (index < this->GetSize() && this->field_[index] == ' ') {
-            index += this->columnsCount_;
+        if (!this->CanPlay(column)) {
+            return false;
         }
 
-        index -= this->columnsCount_;
+        const auto code = this->ColumnCode(column);
+        const auto move = (this->mask_ + this->BottomMask(column)) & BasicBoard::GetColumnMask(column);
 
-        if (index < 0) {
-            return false;
+        this->mask_ |= move;
+        if (moveSymbol == PlayerSymbol::FIRST) {
+            this->firstMask_ |= move;
         }
+        this->UpdateKeys(column, code);
+        this->PushHistory({ column, false, moveSymbol == PlayerSymbol::FIRST });
 
-        this->field_[index] = moveSymbol;
-        this->historyMoves_.push_back(column);
-        
 		return true;
     }
 
+	// PopOut: removes the bottom disc of `column`, which must be `moveSymbol`'s, and lets the rest fall by one.
+	bool PopMove(const short column, const char moveSymbol) {
+		if (!this->CanPop(column, moveSymbol)) {
+			return false;
+		}
+
+		const auto code       = this->ColumnCode(column);
+		const auto columnMask = BasicBoard::GetColumnMask(column);
+
+		this->mask_      = (this->mask_ & ~columnMask) | (((this->mask_ & columnMask) >> 1) & columnMask);
+		this->firstMask_ = (this->firstMask_ & ~columnMask) | (((this->firstMask_ & columnMask) >> 1) & columnMask);
+		this->UpdateKeys(column, code);
+		this->PushHistory({ column, true, moveSymbol == PlayerSymbol::FIRST });
+
+		return true;
+	}
+
     [[nodiscard]] bool IsTie() const {
-        return this->GetNumberOfMoves() == this->field_.size();
+        return this->GetNumberOfMoves() == this->GetSize();
     }
 
 	[[nodiscard]] bool IsWinningMove(const short column, const char character) const {
-		auto copy = *this;
-		return copy.IsWinningMove(column, character);
+		return this->CanPlay(column) && (this->GetPlayableWinningCells(character) & BasicBoard::GetColumnMask(column));
 	}
 
-	[[nodiscard]] bool IsWinningMove(const short column, const char character) {
-		this->MakeMove(column, character);
-		const auto isWin = this->GetWinnerCharacter() == character;
-		this->CancelLastMove();
+	// Empty cells, playable or not, where a disc of `character` would complete a line of Connect.
+	[[nodiscard]] Bitboard GetWinningCells(const char character) const {
+		const auto position = this->GetDiscs(character);
+
+		// Vertical lines can only be completed from above.
+		auto cells = ~Bitboard{ 0 };
+		for (short k = 1; k < Connect; ++k) {
+			cells &= position << k;
+		}
+
+		// A cell completes a line when the m cells before it and the Connect - 1 - m cells after it are set.
+		for (const auto shift : { BasicBoard::DIRECTIONS[1], BasicBoard::DIRECTIONS[2], BasicBoard::DIRECTIONS[3] }) {
+			std::array<Bitboard, Connect> after{ ~Bitboard{ 0 } };
+			for (short k = 1; k < Connect; ++k) {
+				after[k] = after[k - 1] & (position >> k * shift);
+			}
 
-		return isWin;
+			auto before = ~Bitboard{ 0 };
+			for (short k = 0; k < Connect; ++k) {
+				if (k > 0) {
+					before &= position << k * shift;
+				}
+				cells |= before & after[Connect - 1 - k];
+			}
+		}
+
+		return cells & (BasicBoard::BOARD_MASK ^ this->mask_);
+	}
+
+	// Cells where the next disc of any column would land.
+	[[nodiscard]] Bitboard GetPlayableCells() const {
+		return (this->mask_ + BasicBoard::BOTTOM_ROW_MASK) & BasicBoard::BOARD_MASK;
+	}
+
+	[[nodiscard]] Bitboard GetPlayableWinningCells(const char character) const {
+		return this->GetWinningCells(character) & this->GetPlayableCells();
+	}
+
+	[[nodiscard]] std::array<std::byte, SERIALIZED_SIZE> Serialize() const requires ((Rows + 1) * Columns <= 64) {
+		std::array<std::byte, SERIALIZED_SIZE> bytes{};
+		const auto code = static_cast<uint64_t>(this->ToExactKey());
+
+		for (size_t i = 0; i < SERIALIZED_SIZE; ++i) {
+			bytes[i] = static_cast<std::byte>(code >> 8 * i);
+		}
+
+		return bytes;
+	}
+
+	// Writes `boards.size()` consecutive records into `bytes`, which must hold exactly that many.
+	static void SerializeBatch(const std::span<const BasicBoard> boards, const std::span<std::byte> bytes)
+		requires ((Rows + 1) * Columns <= 64) {
+		if (bytes.size() != boards.size() * SERIALIZED_SIZE) {
+			throw std::length_error("Buffer size does not match the number of boards.");
+		}
+
+		for (size_t i = 0; i < boards.size(); ++i) {
+			const auto record = boards[i].Serialize();
+			std::copy(record.cbegin(), record.cend(), bytes.begin() + i * SERIALIZED_SIZE);
+		}
 	}
 
 	[[nodiscard]] unsigned GetNumberOfMoves() const {
-        return this->historyMoves_.size();
+        return static_cast<unsigned>(bitboard::Popcount(this->mask_));
     }
 
     static void ColorPrintCell(const char cell, const std::pair<char, char>& playerSymbols) {
@@ -227,452 +585,181 @@ public:
     }
 
 	bool CancelLastMove() {
-		return this->CancelMove(this->historyMoves_.back());
+		if (this->historySize_ == 0) {
+			return false;
+		}
+
+		const auto record = this->historyMoves_[--this->historySize_];
+		if (record.IsPop()) {
+			this->CancelPop(record.GetColumn(), record.IsFirst());
+			return true;
+		}
+
+		return this->CancelMove(record.GetColumn());
 	}
 
 private:
-    short rowsCount_ = 6, columnsCount_ = 7;
-    std::vector<char> field_;
-    std::deque<short> historyMoves_;
+    // Drops alone never make more moves than there are cells; pops make games unbounded, so a
+    // full history drops its oldest entry instead.
+    static constexpr size_t MAX_MOVES = static_cast<size_t>(Rows) * Columns;
 
-	bool CancelMove(short column) {
-		auto index = static_cast<int>(column);
-		while (index < this->GetSize() && this->field_[index] == ' ') {
-			index += this->columnsCount_;
-		}
+    // ColumnCode() of an empty column: just the marker bit.
+    static constexpr uint64_t EMPTY_COLUMN_CODE = 1;
 
-		if (index >= this->GetSize()) {
-			return false;
-		}
+    static constexpr int KEY_CHUNK_BITS = Rows + 1 < 8 ? Rows + 1 : 8;
+    static constexpr int KEY_CHUNKS     = (Rows + KEY_CHUNK_BITS) / KEY_CHUNK_BITS;
+
+    static constexpr Bitboard BOTTOM_ROW_MASK = [] {
+        auto mask = Bitboard{ 0 };
+        for (short column = 0; column < Columns; ++column) {
+            mask |= Bitboard{ 1 } << column * (Rows + 1);
+        }
+
+        return mask;
+    }();
+
+    Bitboard mask_      = 0;
+    Bitboard firstMask_ = 0;
+    uint64_t key_       = 0;
+    uint64_t mirrorKey_ = 0;
+    unsigned historySize_ = 0;
+    std::array<MoveRecord, MAX_MOVES> historyMoves_{};
+
+    // Tabulation keys of column contents: the key of a column is the xor of one random key per
+    // KEY_CHUNK_BITS-bit chunk of its ColumnCode(), and the board key is the xor over columns. A drop
+    // or a pop, which shifts a whole column, then changes the board key with a few lookups. The
+    // first chunk's keys are offset so that an empty column, and so the empty board, has key 0.
+    static constexpr auto COLUMN_KEYS = [] {
+        std::array<std::array<std::array<uint64_t, size_t{ 1 } << KEY_CHUNK_BITS>, KEY_CHUNKS>, Columns> keys{};
+        auto state = uint64_t{ 0 };
+
+        for (auto& column : keys) {
+            for (auto& chunk : column) {
+                for (auto& key : chunk) {
+                    key = utils::SplitMix64(state);
+                }
+            }
+
+            auto emptyKey = column[0][EMPTY_COLUMN_CODE];
+            for (auto chunk = 1; chunk < KEY_CHUNKS; ++chunk) {
+                emptyKey ^= column[chunk][0];
+            }
+            for (auto& key : column[0]) {
+                key ^= emptyKey;
+            }
+        }
+
+        return keys;
+    }();
+
+    // The slice of ToExactKey() for `column`: its first player's discs under a marker bit.
+    [[nodiscard]] uint64_t ColumnCode(const short column) const {
+        const auto columnMask = BasicBoard::GetColumnMask(column);
+
+        return bitboard::LowWord(((this->firstMask_ & columnMask) + (this->mask_ & columnMask)) >> column * (Rows + 1)) + 1;
+    }
+
+    [[nodiscard]] static uint64_t ColumnKey(const short column, uint64_t code) {
+        auto key = uint64_t{ 0 };
+        for (const auto& chunk : BasicBoard::COLUMN_KEYS[column]) {
+            key  ^= chunk[code & ((uint64_t{ 1 } << KEY_CHUNK_BITS) - 1)];
+            code >>= KEY_CHUNK_BITS;
+        }
+
+        return key;
+    }
+
+    // Replaces the key of `column` with contents `previousCode` by the key of its current contents,
+    // in the position key and, at the mirrored column, in the mirror key.
+    void UpdateKeys(const short column, const uint64_t previousCode) {
+        const auto code   = this->ColumnCode(column);
+        const auto mirror = BasicBoard::MirrorColumn(column);
+
+        this->key_       ^= BasicBoard::ColumnKey(column, previousCode) ^ BasicBoard::ColumnKey(column, code);
+        this->mirrorKey_ ^= BasicBoard::ColumnKey(mirror, previousCode) ^ BasicBoard::ColumnKey(mirror, code);
+    }
+
+    void PushHistory(const MoveRecord record) {
+        if (this->historySize_ == MAX_MOVES) {
+            std::copy(this->historyMoves_.cbegin() + 1, this->historyMoves_.cend(), this->historyMoves_.begin());
+            --this->historySize_;
+        }
+
+        this->historyMoves_[this->historySize_++] = record;
+    }
 
-		this->field_[index] = ' ';
+    [[nodiscard]] static constexpr Bitboard BottomMask(const short column) {
+        return Bitboard{ 1 } << column * (Rows + 1);
+    }
+
+    [[nodiscard]] static constexpr Bitboard TopMask(const short column) {
+        return Bitboard{ 1 } << (Rows - 1 + column * (Rows + 1));
+    }
+
+
+    [[nodiscard]] char ReadCell(const short row, const short column) const {
+        const auto cell = BasicBoard::GetCellMask(row, column);
+        if (!(this->mask_ & cell)) {
+            return PlayerSymbol::NONE;
+        }
+
+        return this->firstMask_ & cell ? PlayerSymbol::FIRST : PlayerSymbol::SECOND;
+    }
+
+    [[nodiscard]] Bitboard GetTopCellMask(const short column) const {
+        return (((this->mask_ & BasicBoard::GetColumnMask(column)) + this->BottomMask(column)) >> 1) & this->mask_;
+    }
+
+    // True if `position` has Connect in a row on a line through `cell`.
+    [[nodiscard]] static bool IsAlignedThrough(const Bitboard position, const Bitboard cell) {
+        for (const auto shift : BasicBoard::DIRECTIONS) {
+            if (BasicBoard::MatchRuns(position, cell, shift)) {
+                return true;
+            }
+        }
 
-		auto it = std::ranges::find(this->historyMoves_, column);
-		if (it != this->historyMoves_.cend()) {
-			this->historyMoves_.erase(it);
+        return false;
+    }
+
+    // Lowest bits of the runs of Connect along `shift` that start on `starts` or up to Connect - 1
+    // steps before it. `runs` marks runs of `Length` and every step doubles it, so the steps unroll
+    // at compile time into the same shift-ands as a hand-written check.
+    template<short Length = 1>
+    [[nodiscard]] static Bitboard MatchRuns(const Bitboard runs, const Bitboard starts, const int shift) {
+        if constexpr (Length >= Connect) {
+            return runs & starts;
+        }
+        else {
+            constexpr auto step = std::min<short>(Length, Connect - Length);
+
+            return BasicBoard::MatchRuns<Length + step>(runs & (runs >> step * shift), starts | (starts >> step * shift), shift);
+        }
+    }
+
+	bool CancelMove(short column) {
+		const auto cell = this->GetTopCellMask(column);
+		if (!cell) {
+			return false;
 		}
 
+		const auto code = this->ColumnCode(column);
+		this->mask_      &= ~cell;
+		this->firstMask_ &= ~cell;
+		this->UpdateKeys(column, code);
+
 		return true;
 	}
 
-    const static std::vector<std::array<std::pair<Row, Column>, 4>> WINNING_COMBOS;
+	// Puts the popped disc back under `column`, lifting the rest by one.
+	void CancelPop(const short column, const bool isFirst) {
+		const auto code       = this->ColumnCode(column);
+		const auto columnMask = BasicBoard::GetColumnMask(column);
+		const auto bottom     = BasicBoard::BottomMask(column);
+
+		this->mask_      = (this->mask_ & ~columnMask) | ((this->mask_ & columnMask) << 1) | bottom;
+		this->firstMask_ = (this->firstMask_ & ~columnMask) | ((this->firstMask_ & columnMask) << 1) | (isFirst ? bottom : Bitboard{ 0 });
+		this->UpdateKeys(column, code);
+	}
 };
 
-#pragma region hardcoded winning combos
-	const std::vector<std::array<std::pair<Row, Column>, 4>> Board::WINNING_COMBOS = {
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::FIRST),
-	            std::pair(Row::SECOND, Column::FIRST),
-	            std::pair(Row::THIRD, Column::FIRST),
-	            std::pair(Row::FOURTH, Column::FIRST)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::FIRST),
-	            std::pair(Row::THIRD, Column::FIRST),
-	            std::pair(Row::FOURTH, Column::FIRST),
-	            std::pair(Row::FIFTH, Column::FIRST)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::FIRST),
-	            std::pair(Row::FOURTH, Column::FIRST),
-	            std::pair(Row::FIFTH, Column::FIRST),
-	            std::pair(Row::SIXTH, Column::FIRST)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::SECOND),
-	            std::pair(Row::SECOND, Column::SECOND),
-	            std::pair(Row::THIRD, Column::SECOND),
-	            std::pair(Row::FOURTH, Column::SECOND)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::SECOND),
-	            std::pair(Row::THIRD, Column::SECOND),
-	            std::pair(Row::FOURTH, Column::SECOND),
-	            std::pair(Row::FIFTH, Column::SECOND)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::SECOND),
-	            std::pair(Row::FOURTH, Column::SECOND),
-	            std::pair(Row::FIFTH, Column::SECOND),
-	            std::pair(Row::SIXTH, Column::SECOND)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::THIRD),
-	            std::pair(Row::SECOND, Column::THIRD),
-	            std::pair(Row::THIRD, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::THIRD)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::THIRD),
-	            std::pair(Row::THIRD, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::THIRD),
-	            std::pair(Row::FIFTH, Column::THIRD)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::THIRD),
-	            std::pair(Row::FIFTH, Column::THIRD),
-	            std::pair(Row::SIXTH, Column::THIRD)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::FOURTH),
-	            std::pair(Row::SECOND, Column::FOURTH),
-	            std::pair(Row::THIRD, Column::FOURTH),
-	            std::pair(Row::FOURTH, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::FOURTH),
-	            std::pair(Row::THIRD, Column::FOURTH),
-	            std::pair(Row::FOURTH, Column::FOURTH),
-	            std::pair(Row::FIFTH, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::FOURTH),
-	            std::pair(Row::FOURTH, Column::FOURTH),
-	            std::pair(Row::FIFTH, Column::FOURTH),
-	            std::pair(Row::SIXTH, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::FIFTH),
-	            std::pair(Row::SECOND, Column::FIFTH),
-	            std::pair(Row::THIRD, Column::FIFTH),
-	            std::pair(Row::FOURTH, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::FIFTH),
-	            std::pair(Row::THIRD, Column::FIFTH),
-	            std::pair(Row::FOURTH, Column::FIFTH),
-	            std::pair(Row::FIFTH, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::FIFTH),
-	            std::pair(Row::FOURTH, Column::FIFTH),
-	            std::pair(Row::FIFTH, Column::FIFTH),
-	            std::pair(Row::SIXTH, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::SIXTH),
-	            std::pair(Row::SECOND, Column::SIXTH),
-	            std::pair(Row::THIRD, Column::SIXTH),
-	            std::pair(Row::FOURTH, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::SIXTH),
-	            std::pair(Row::THIRD, Column::SIXTH),
-	            std::pair(Row::FOURTH, Column::SIXTH),
-	            std::pair(Row::FIFTH, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::SIXTH),
-	            std::pair(Row::FOURTH, Column::SIXTH),
-	            std::pair(Row::FIFTH, Column::SIXTH),
-	            std::pair(Row::SIXTH, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::SEVENTH),
-	            std::pair(Row::SECOND, Column::SEVENTH),
-	            std::pair(Row::THIRD, Column::SEVENTH),
-	            std::pair(Row::FOURTH, Column::SEVENTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::SEVENTH),
-	            std::pair(Row::THIRD, Column::SEVENTH),
-	            std::pair(Row::FOURTH, Column::SEVENTH),
-	            std::pair(Row::FIFTH, Column::SEVENTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::SEVENTH),
-	            std::pair(Row::FOURTH, Column::SEVENTH),
-	            std::pair(Row::FIFTH, Column::SEVENTH),
-	            std::pair(Row::SIXTH, Column::SEVENTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::FIRST),
-	            std::pair(Row::FIRST, Column::SECOND),
-	            std::pair(Row::FIRST, Column::THIRD),
-	            std::pair(Row::FIRST, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::SECOND),
-	            std::pair(Row::FIRST, Column::THIRD),
-	            std::pair(Row::FIRST, Column::FOURTH),
-	            std::pair(Row::FIRST, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::THIRD),
-	            std::pair(Row::FIRST, Column::FOURTH),
-	            std::pair(Row::FIRST, Column::FIFTH),
-	            std::pair(Row::FIRST, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::FOURTH),
-	            std::pair(Row::FIRST, Column::FIFTH),
-	            std::pair(Row::FIRST, Column::SIXTH),
-	            std::pair(Row::FIRST, Column::SEVENTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::FIRST),
-	            std::pair(Row::SECOND, Column::SECOND),
-	            std::pair(Row::SECOND, Column::THIRD),
-	            std::pair(Row::SECOND, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::SECOND),
-	            std::pair(Row::SECOND, Column::THIRD),
-	            std::pair(Row::SECOND, Column::FOURTH),
-	            std::pair(Row::SECOND, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::THIRD),
-	            std::pair(Row::SECOND, Column::FOURTH),
-	            std::pair(Row::SECOND, Column::FIFTH),
-	            std::pair(Row::SECOND, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::FOURTH),
-	            std::pair(Row::SECOND, Column::FIFTH),
-	            std::pair(Row::SECOND, Column::SIXTH),
-	            std::pair(Row::SECOND, Column::SEVENTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::FIRST),
-	            std::pair(Row::THIRD, Column::SECOND),
-	            std::pair(Row::THIRD, Column::THIRD),
-	            std::pair(Row::THIRD, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::SECOND),
-	            std::pair(Row::THIRD, Column::THIRD),
-	            std::pair(Row::THIRD, Column::FOURTH),
-	            std::pair(Row::THIRD, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::THIRD),
-	            std::pair(Row::THIRD, Column::FOURTH),
-	            std::pair(Row::THIRD, Column::FIFTH),
-	            std::pair(Row::THIRD, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::FOURTH),
-	            std::pair(Row::THIRD, Column::FIFTH),
-	            std::pair(Row::THIRD, Column::SIXTH),
-	            std::pair(Row::THIRD, Column::SEVENTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FOURTH, Column::FIRST),
-	            std::pair(Row::FOURTH, Column::SECOND),
-	            std::pair(Row::FOURTH, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FOURTH, Column::SECOND),
-	            std::pair(Row::FOURTH, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::FOURTH),
-	            std::pair(Row::FOURTH, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FOURTH, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::FOURTH),
-	            std::pair(Row::FOURTH, Column::FIFTH),
-	            std::pair(Row::FOURTH, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FOURTH, Column::FOURTH),
-	            std::pair(Row::FOURTH, Column::FIFTH),
-	            std::pair(Row::FOURTH, Column::SIXTH),
-	            std::pair(Row::FOURTH, Column::SEVENTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIFTH, Column::FIRST),
-	            std::pair(Row::FIFTH, Column::SECOND),
-	            std::pair(Row::FIFTH, Column::THIRD),
-	            std::pair(Row::FIFTH, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIFTH, Column::SECOND),
-	            std::pair(Row::FIFTH, Column::THIRD),
-	            std::pair(Row::FIFTH, Column::FOURTH),
-	            std::pair(Row::FIFTH, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIFTH, Column::THIRD),
-	            std::pair(Row::FIFTH, Column::FOURTH),
-	            std::pair(Row::FIFTH, Column::FIFTH),
-	            std::pair(Row::FIFTH, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIFTH, Column::FOURTH),
-	            std::pair(Row::FIFTH, Column::FIFTH),
-	            std::pair(Row::FIFTH, Column::SIXTH),
-	            std::pair(Row::FIFTH, Column::SEVENTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SIXTH, Column::FIRST),
-	            std::pair(Row::SIXTH, Column::SECOND),
-	            std::pair(Row::SIXTH, Column::THIRD),
-	            std::pair(Row::SIXTH, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SIXTH, Column::SECOND),
-	            std::pair(Row::SIXTH, Column::THIRD),
-	            std::pair(Row::SIXTH, Column::FOURTH),
-	            std::pair(Row::SIXTH, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SIXTH, Column::THIRD),
-	            std::pair(Row::SIXTH, Column::FOURTH),
-	            std::pair(Row::SIXTH, Column::FIFTH),
-	            std::pair(Row::SIXTH, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SIXTH, Column::FOURTH),
-	            std::pair(Row::SIXTH, Column::FIFTH),
-	            std::pair(Row::SIXTH, Column::SIXTH),
-	            std::pair(Row::SIXTH, Column::SEVENTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::FIRST),
-	            std::pair(Row::FOURTH, Column::SECOND),
-	            std::pair(Row::FIFTH, Column::THIRD),
-	            std::pair(Row::SIXTH, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::FIRST),
-	            std::pair(Row::THIRD, Column::SECOND),
-	            std::pair(Row::FOURTH, Column::THIRD),
-	            std::pair(Row::FIFTH, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::SECOND),
-	            std::pair(Row::FOURTH, Column::THIRD),
-	            std::pair(Row::FIFTH, Column::FOURTH),
-	            std::pair(Row::SIXTH, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::FIRST),
-	            std::pair(Row::SECOND, Column::SECOND),
-	            std::pair(Row::THIRD, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::SECOND),
-	            std::pair(Row::THIRD, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::FOURTH),
-	            std::pair(Row::FIFTH, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::FOURTH),
-	            std::pair(Row::FIFTH, Column::FIFTH),
-	            std::pair(Row::SIXTH, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::SECOND),
-	            std::pair(Row::SECOND, Column::THIRD),
-	            std::pair(Row::THIRD, Column::FOURTH),
-	            std::pair(Row::FOURTH, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::THIRD),
-	            std::pair(Row::THIRD, Column::FOURTH),
-	            std::pair(Row::FOURTH, Column::FIFTH),
-	            std::pair(Row::FIFTH, Column::SIXTH),
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::THIRD, Column::FOURTH),
-	            std::pair(Row::FOURTH, Column::FIFTH),
-	            std::pair(Row::FIFTH, Column::SIXTH),
-	            std::pair(Row::SIXTH, Column::SEVENTH),
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::THIRD),
-	            std::pair(Row::SECOND, Column::FOURTH),
-	            std::pair(Row::THIRD, Column::FIFTH),
-	            std::pair(Row::FOURTH, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::FOURTH),
-	            std::pair(Row::THIRD, Column::FIFTH),
-	            std::pair(Row::FOURTH, Column::SIXTH),
-	            std::pair(Row::FIFTH, Column::SEVENTH),
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::FOURTH),
-	            std::pair(Row::SECOND, Column::FIFTH),
-	            std::pair(Row::THIRD, Column::SIXTH),
-	            std::pair(Row::FOURTH, Column::SEVENTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::FOURTH),
-	            std::pair(Row::SECOND, Column::THIRD),
-	            std::pair(Row::THIRD, Column::SECOND),
-	            std::pair(Row::FOURTH, Column::FIRST)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SIXTH, Column::FOURTH),
-	            std::pair(Row::FIFTH, Column::FIFTH),
-	            std::pair(Row::FOURTH, Column::SIXTH),
-	            std::pair(Row::THIRD, Column::SEVENTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIRST, Column::FIFTH),
-	            std::pair(Row::SECOND, Column::FOURTH),
-	            std::pair(Row::THIRD, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::SECOND)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SECOND, Column::FOURTH),
-	            std::pair(Row::THIRD, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::SECOND),
-	            std::pair(Row::FIFTH, Column::FIRST)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SIXTH, Column::FIRST),
-	            std::pair(Row::FIFTH, Column::SECOND),
-	            std::pair(Row::FOURTH, Column::THIRD),
-	            std::pair(Row::THIRD, Column::FOURTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIFTH, Column::SECOND),
-	            std::pair(Row::FOURTH, Column::THIRD),
-	            std::pair(Row::THIRD, Column::FOURTH),
-	            std::pair(Row::SECOND, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FOURTH, Column::THIRD),
-	            std::pair(Row::THIRD, Column::FOURTH),
-	            std::pair(Row::SECOND, Column::FIFTH),
-	            std::pair(Row::FIRST, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SIXTH, Column::SECOND),
-	            std::pair(Row::FIFTH, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::FOURTH),
-	            std::pair(Row::THIRD, Column::FIFTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIFTH, Column::THIRD),
-	            std::pair(Row::FOURTH, Column::FOURTH),
-	            std::pair(Row::THIRD, Column::FIFTH),
-	            std::pair(Row::SECOND, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FOURTH, Column::FOURTH),
-	            std::pair(Row::THIRD, Column::FIFTH),
-	            std::pair(Row::SECOND, Column::SIXTH),
-	            std::pair(Row::FIRST, Column::SEVENTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::SIXTH, Column::THIRD),
-	            std::pair(Row::FIFTH, Column::FOURTH),
-	            std::pair(Row::FOURTH, Column::FIFTH),
-	            std::pair(Row::THIRD, Column::SIXTH)
-	    },
-	    std::array<std::pair<Row, Column>, 4> {
-	            std::pair(Row::FIFTH, Column::FOURTH),
-	            std::pair(Row::FOURTH, Column::FIFTH),
-	            std::pair(Row::THIRD, Column::SIXTH),
-	            std::pair(Row::SECOND, Column::SEVENTH)
-	    },
-	};
-#pragma endregion
+using Board = BasicBoard<>;
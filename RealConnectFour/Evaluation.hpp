@@ -0,0 +1,113 @@
+#pragma once
+
+#include <array>
+#include <utility>
+
+enum PlayerScore : short {
+	PLAYER_FOUR_IN_A_ROW = 10,
+	PLAYER_THREE_IN_A_ROW = 7,
+	PLAYER_TWO_IN_A_ROW = 1,
+	PLAYER_CENTER = 2,
+	PLAYER_NEAR_CENTER = -1,
+	PLAYER_NEAR_EDGE = -1,
+	PLAYER_EDGE = -1
+};
+
+enum OpponentScore : short {
+	OPPONENT_FOUR_IN_A_ROW = -20,
+	OPPONENT_THREE_IN_A_ROW = -9,
+	OPPONENT_TWO_IN_A_ROW = 0,
+	OPPONENT_CENTER = 0,
+	OPPONENT_NEAR_CENTER = 0,
+	OPPONENT_NEAR_EDGE = 0,
+	OPPONENT_EDGE = 0
+};
+
+namespace evaluation {
+	// Score of one Connect-cell window from how many of its cells are the player's, the opponent's and empty.
+	// The four/three/two tiers stand for a full window, one cell short and two cells short of it.
+	template<short Connect = 4>
+	constexpr int ScoreWindow(const int playerCount, const int opponentCount, const int blankCount) {
+		auto score = 0;
+
+		// My influence
+		if (playerCount == Connect) {
+			score += PlayerScore::PLAYER_FOUR_IN_A_ROW;
+		}
+		else if (playerCount == Connect - 1 && blankCount == 1) {
+			score += PlayerScore::PLAYER_THREE_IN_A_ROW;
+		}
+		else if (Connect > 2 && playerCount == Connect - 2 && blankCount == 2) {
+			score += PlayerScore::PLAYER_TWO_IN_A_ROW;
+		}
+
+		// Opponent's influence
+		if (opponentCount == Connect) {
+			score += OpponentScore::OPPONENT_FOUR_IN_A_ROW;
+		}
+		if (opponentCount == Connect - 1 && blankCount == 1) {
+			score += OpponentScore::OPPONENT_THREE_IN_A_ROW;
+		}
+		else if (Connect > 2 && opponentCount == Connect - 2 && blankCount == 2) {
+			score += OpponentScore::OPPONENT_TWO_IN_A_ROW;
+		}
+
+		return score;
+	}
+
+	// ScoreWindow for every pair of counts, indexed [playerCount][opponentCount]; a window holds Connect
+	// cells, so the blanks follow from the two. Built at compile time from the weights above.
+	template<short Connect = 4>
+	inline constexpr auto WINDOW_SCORES = [] {
+		std::array<std::array<int, Connect + 1>, Connect + 1> scores{};
+
+		for (auto playerCount = 0; playerCount <= Connect; ++playerCount) {
+			for (auto opponentCount = 0; playerCount + opponentCount <= Connect; ++opponentCount) {
+				scores[playerCount][opponentCount] = ScoreWindow<Connect>(playerCount, opponentCount, Connect - playerCount - opponentCount);
+			}
+		}
+
+		return scores;
+	}();
+
+	// Columns from the center outwards (left one first on ties) with their position bonuses:
+	// center, near center, near edge and edge by distance from the middle of the board.
+	template<short Columns>
+	constexpr auto MakeColumnsOrder() {
+		std::array<std::pair<short, std::pair<PlayerScore, OpponentScore>>, Columns> order{};
+		const auto distance    = [](const int column) {
+			const auto offset = 2 * column - (Columns - 1);
+			return (offset < 0 ? -offset : offset) / 2;
+		};
+		const auto maxDistance = distance(0);
+
+		auto index = 0;
+		for (auto current = 0; current <= maxDistance; ++current) {
+			const auto cost =
+				current == 0               ? std::pair(PlayerScore::PLAYER_CENTER, OpponentScore::OPPONENT_CENTER)
+				: current == maxDistance     ? std::pair(PlayerScore::PLAYER_EDGE, OpponentScore::OPPONENT_EDGE)
+				: current == maxDistance - 1 ? std::pair(PlayerScore::PLAYER_NEAR_EDGE, OpponentScore::OPPONENT_NEAR_EDGE)
+				: std::pair(PlayerScore::PLAYER_NEAR_CENTER, OpponentScore::OPPONENT_NEAR_CENTER);
+
+			for (short column = 0; column < Columns; ++column) {
+				if (distance(column) == current) {
+					order[index++] = { column, cost };
+				}
+			}
+		}
+
+		return order;
+	}
+
+	// Position bonuses of a disc in each column, for its own side and for the other side.
+	template<short Columns>
+	inline constexpr auto COLUMN_BONUSES = [] {
+		std::array<std::pair<int, int>, Columns> bonuses{};
+
+		for (const auto& [column, cost] : MakeColumnsOrder<Columns>()) {
+			bonuses[column] = { cost.first, cost.second };
+		}
+
+		return bonuses;
+	}();
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Board.hpp"
+
+// Direct-mapped cache of leaf scores. Each position key picks a single slot and a newer entry simply
+// replaces whatever lived there, so lookups and stores are one probe and the memory use is fixed.
+// The heuristic is symmetric, so a position and its mirror image share an entry.
+template<short Rows = 6, short Columns = 7, short Connect = 4>
+class BasicEvaluationCache {
+	using BoardType = BasicBoard<Rows, Columns, Connect>;
+
+	// Exact position codes are never zero, so a default entry matches nothing.
+	struct Entry {
+		typename BoardType::Bitboard position;
+		int score;
+		char playerSymbol;
+	};
+public:
+	static constexpr size_t DEFAULT_SIZE = size_t{ 1 } << 16;
+
+	//------------------------------------------------- CTOR SECTION -------------------------------------------------//
+
+	// `size` entries rounded down to a power of two; 0 turns the cache off.
+	explicit BasicEvaluationCache(const size_t size = DEFAULT_SIZE)
+		: entries_(size == 0 ? 0 : std::bit_floor(size)) {}
+
+	BasicEvaluationCache(const BasicEvaluationCache&) = default;
+	BasicEvaluationCache(BasicEvaluationCache&&) noexcept = default;
+
+	//----------------------------------------------- DTOR SECTION ---------------------------------------------------//
+
+	~BasicEvaluationCache() noexcept = default;
+
+	//--------------------------------------------- OPERATOR SECTION -------------------------------------------------//
+
+	BasicEvaluationCache& operator=(const BasicEvaluationCache&) = default;
+	BasicEvaluationCache& operator=(BasicEvaluationCache&&) noexcept = default;
+
+	//-------------------------------------------- ACCESSOR SECTION --------------------------------------------------//
+
+	[[nodiscard]] size_t GetSize() const {
+		return this->entries_.size();
+	}
+
+	// Score of `board` for `playerSymbol`, if its slot still holds it.
+	bool TryGetScore(const BoardType& board, const char playerSymbol, int& score) const {
+		if (this->entries_.empty()) {
+			return false;
+		}
+
+		const auto& entry = this->entries_[this->GetSlot(board)];
+		if (entry.playerSymbol != playerSymbol || entry.position != board.ToCanonicalExactKey()) {
+			return false;
+		}
+
+		score = entry.score;
+		return true;
+	}
+
+	//--------------------------------------------- METHOD SECTION ---------------------------------------------------//
+
+	void Clear() {
+		std::fill(this->entries_.begin(), this->entries_.end(), Entry{});
+	}
+
+	void Insert(const BoardType& board, const char playerSymbol, const int score) {
+		if (this->entries_.empty()) {
+			return;
+		}
+
+		this->entries_[this->GetSlot(board)] = { board.ToCanonicalExactKey(), score, playerSymbol };
+	}
+
+private:
+	std::vector<Entry> entries_;
+
+	// Keys are tabulation hashes, so their low bits are as good as any.
+	[[nodiscard]] size_t GetSlot(const BoardType& board) const {
+		return static_cast<size_t>(board.ToCanonicalKey()) & (this->entries_.size() - 1);
+	}
+};
+
+using EvaluationCache = BasicEvaluationCache<>;
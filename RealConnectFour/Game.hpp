@@ -19,10 +19,11 @@ public:
     Game(const Game&) = delete;
     Game(Game&&) noexcept = default;
 	
-    explicit Game(const Player& first, const Player& second, ISolver* solver, bool isFirstPlayerFirst, bool isHotseat)
+    explicit Game(const Player& first, const Player& second, ISolver* solver, bool isFirstPlayerFirst, bool isHotseat,
+        Variant variant = Variant::CLASSIC)
         : board_(std::make_unique<Board>()), solver_(solver),
 		  firstPlayer_(std::make_shared<Player>(first)), secondPlayer_(std::make_shared<Player>(second)),
-          currentPlayer_(isFirstPlayerFirst ? firstPlayer_ : secondPlayer_), isHotseat_(isHotseat) {}
+          currentPlayer_(isFirstPlayerFirst ? firstPlayer_ : secondPlayer_), isHotseat_(isHotseat), variant_(variant) {}
 
     //--------------------------------------------- OPERATOR SECTION -------------------------------------------------//
 
@@ -80,10 +81,13 @@ public:
                 //std::clog << "Make a move. Enter the value " << 1 << "-" << this->board_->GetColumnsCount() << std::endl;
 
                 fmt::print("Make a move. Enter the value {}-{}\n", 1, this->board_->GetColumnsCount());
+                if (this->variant_ == Variant::POP_OUT) {
+                    fmt::print("Or pop out your bottom disc with p{}-p{}\n", 1, this->board_->GetColumnsCount());
+                }
             	
                 if (!this->board_->GetHistory().empty()) {
                     //std::clog << "Move was made in " << dye::green(this->board_->GetLastMove() + 1) << " column" << std::endl;
-                    fmt::print("Move was made in ");
+                    fmt::print(this->board_->GetHistory().back().IsPop() ? "Disc was popped out of " : "Move was made in ");
                     fmt::print(fg(fmt::color::green), "{}", this->board_->GetLastMove() + 1);
                     fmt::print(" column\n");
                 	
@@ -99,18 +103,20 @@ public:
 
                 std::string moveStr;
                 std::cin >> moveStr;
-                const auto move = utils::StrToInt(moveStr) - 1;
+                const auto isPop  = this->variant_ == Variant::POP_OUT && moveStr.starts_with('p');
+                const auto column = static_cast<short>(utils::StrToInt(isPop ? moveStr.substr(1) : moveStr) - 1);
 
                 utils::ConsoleClear();
         	
-        		if (move < 0 || move >= this->board_->GetColumnsCount()) {
+        		if (column < 0 || column >= this->board_->GetColumnsCount()) {
                     //std::clog << dye::red("This column doesn't exist!") << std::endl;
                     fmt::print(fmt::fg(fmt::color::red), "{}\n", "This column doesn't exist!");	
                     continue;
         		}
-                if (!this->currentPlayer_->MakeMove(this->board_.get(), move)) {
+                if (!this->currentPlayer_->MakeMove(this->board_.get(), isPop ? Board::ToPopMove(column) : column)) {
                     /*std::clog << dye::red("This column was filled!") << std::endl;*/
-                    fmt::print(fmt::fg(fmt::color::red), "{}\n", "This column doesn't exist!");
+                    fmt::print(fmt::fg(fmt::color::red), "{}\n",
+                        isPop ? "The bottom disc of this column isn't yours!" : "This column doesn't exist!");
                     continue;
                 }
 
@@ -133,9 +139,10 @@ public:
                 utils::ConsoleClear();
             }
 
-            switch (this->board_->GetWinnerCharacter()) {
+            // Not necessarily the current player: in PopOut a pop can complete the opponent's line.
+            switch (const auto winner = this->board_->GetWinnerCharacter(); winner) {
 				case 'X': case 'O': {
-                    Board::ColorPrintCell(this->currentPlayer_->GetCharacter(),
+                    Board::ColorPrintCell(winner,
                         { this->firstPlayer_->GetCharacter(), this->secondPlayer_->GetCharacter() });
 					
                     fmt::print(fg(fmt::color::green), " {}\n", "player has won!");
@@ -182,4 +189,5 @@ private:
     std::shared_ptr<Player> currentPlayer_;
 
     bool isHotseat_;
+    Variant variant_;
 };
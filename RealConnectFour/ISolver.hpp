@@ -3,19 +3,22 @@
 #include "Board.hpp"
 #include "Player.hpp"
 
-struct ISolver {
+template<short Rows = 6, short Columns = 7, short Connect = 4>
+struct IBasicSolver {
 public:
-	ISolver() = default;
-	ISolver(const ISolver&) = default;
-	ISolver(ISolver&&) noexcept = default;
+	IBasicSolver() = default;
+	IBasicSolver(const IBasicSolver&) = default;
+	IBasicSolver(IBasicSolver&&) noexcept = default;
 
-	ISolver& operator=(const ISolver&) = default;
-	ISolver& operator=(ISolver&&) noexcept = default;
+	IBasicSolver& operator=(const IBasicSolver&) = default;
+	IBasicSolver& operator=(IBasicSolver&&) noexcept = default;
 
-	virtual ~ISolver() noexcept = default;
+	virtual ~IBasicSolver() noexcept = default;
 
-	[[nodiscard]] virtual short Solve(const Board&, const std::pair<Player, Player>& players) = 0;
+	[[nodiscard]] virtual short Solve(const BasicBoard<Rows, Columns, Connect>&, const std::pair<Player, Player>& players) = 0;
 
 protected:
 
-};
\ No newline at end of file
+};
+
+using ISolver = IBasicSolver<>;
\ No newline at end of file
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include "Board.hpp"
+#include "Evaluation.hpp"
+#include "WinningLines.hpp"
+
+// ClassicSolver heuristic kept up to date across moves. It remembers the position it last saw and
+// the number of discs of each side on every winning line; Sync moves it to another position by
+// re-scoring only the lines through cells that differ, so a drop, a pop or an undo costs a handful
+// of lines and reading the score is O(1).
+template<short Rows = 6, short Columns = 7, short Connect = 4>
+class IncrementalEvaluator {
+	using BoardType = BasicBoard<Rows, Columns, Connect>;
+	using Lines     = WinningLines<Rows, Columns, Connect>;
+public:
+	using Bitboard = typename BoardType::Bitboard;
+
+	//------------------------------------------------- CTOR SECTION -------------------------------------------------//
+
+	explicit IncrementalEvaluator() = default;
+
+	explicit IncrementalEvaluator(const BoardType& board) {
+		this->Sync(board);
+	}
+
+	//-------------------------------------------- ACCESSOR SECTION --------------------------------------------------//
+
+	// Score of the last synced position for `playerSymbol` against the other side.
+	[[nodiscard]] int GetScore(const char playerSymbol) const {
+		return this->scores_[playerSymbol == PlayerSymbol::FIRST ? 0 : 1];
+	}
+
+	//--------------------------------------------- METHOD SECTION ---------------------------------------------------//
+
+	void Sync(const BoardType& board) {
+		const std::array<Bitboard, 2> discs{ board.GetDiscs(PlayerSymbol::FIRST), board.GetDiscs(PlayerSymbol::SECOND) };
+
+		for (auto changed = (discs[0] ^ this->discs_[0]) | (discs[1] ^ this->discs_[1]); changed != 0; changed &= changed - 1) {
+			const auto index = bitboard::CountrZero(changed);
+			const auto cell  = Bitboard{ 1 } << index;
+
+			for (auto side = 0; side < 2; ++side) {
+				if (this->discs_[side] & cell) {
+					this->Toggle(index, side, -1);
+				}
+			}
+			for (auto side = 0; side < 2; ++side) {
+				if (discs[side] & cell) {
+					this->Toggle(index, side, 1);
+				}
+			}
+		}
+
+		this->discs_ = discs;
+	}
+
+private:
+	// Lines through each bit of the board layout.
+	struct CellLines {
+		short count = 0;
+		std::array<short, 4 * Connect> lines{};
+	};
+
+	static constexpr auto CELL_LINES = [] {
+		std::array<CellLines, (Rows + 1) * Columns> cells{};
+
+		for (size_t line = 0; line < Lines::COUNT; ++line) {
+			for (const auto cell : Lines::CELLS[line]) {
+				auto& through = cells[cell % Columns * (Rows + 1) + Rows - 1 - cell / Columns];
+				through.lines[through.count++] = static_cast<short>(line);
+			}
+		}
+
+		return cells;
+	}();
+
+	std::array<Bitboard, 2> discs_{};
+	std::array<std::array<uint8_t, 2>, Lines::COUNT> counts_{};
+	std::array<int, 2> scores_{};
+
+	// Adds (`delta` = 1) or removes (-1) a disc of `side` on bit `index`.
+	void Toggle(const int index, const int side, const int delta) {
+		const auto& [ownBonus, otherBonus] = evaluation::COLUMN_BONUSES<Columns>[index / (Rows + 1)];
+		this->scores_[side]     += delta * ownBonus;
+		this->scores_[1 - side] += delta * otherBonus;
+
+		const auto& through = IncrementalEvaluator::CELL_LINES[index];
+		for (short i = 0; i < through.count; ++i) {
+			auto& counts = this->counts_[through.lines[i]];
+
+			this->AddLine(counts, -1);
+			counts[side] = static_cast<uint8_t>(counts[side] + delta);
+			this->AddLine(counts, 1);
+		}
+	}
+
+	void AddLine(const std::array<uint8_t, 2>& counts, const int sign) {
+		this->scores_[0] += sign * evaluation::WINDOW_SCORES<Connect>[counts[0]][counts[1]];
+		this->scores_[1] += sign * evaluation::WINDOW_SCORES<Connect>[counts[1]][counts[0]];
+	}
+};
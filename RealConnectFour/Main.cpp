@@ -16,6 +16,8 @@ cxxopts::Options OptionsSetup([[maybe_unused]] const int argc, const char* argv[
 		("f, first", "You go first", cxxopts::value<bool>())
 		("s, second", "You go second", cxxopts::value<bool>())
 		("t, time", "Fixing time of the turn", cxxopts::value<bool>())
+		("p, popout", "Play PopOut: a move may also pop your own disc out of the bottom", cxxopts::value<bool>())
+		("e, eval-cache", "Entries of the AI's leaf evaluation cache, rounded down to a power of two; 0 disables it", cxxopts::value<size_t>())
 		("h, help", "Help", cxxopts::value<bool>());
 	options.allow_unrecognised_options();
 
@@ -79,8 +81,12 @@ int main(const int argc, const char* argv[]) {
 
 	utils::ConsoleClear();
 	
-	const auto solver = std::static_pointer_cast<ISolver>(std::make_shared<ClassicSolver>(depth));
-	auto game         = std::make_unique<Game>(*firstPlayer, *secondPlayer, solver.get(), isFirst, isHotseat);
+	const auto variant = result->count("popout") && (*result)["popout"].as<bool>() ? Variant::POP_OUT : Variant::CLASSIC;
+
+	const auto evaluationCacheSize = result->count("eval-cache") ? (*result)["eval-cache"].as<size_t>() : EvaluationCache::DEFAULT_SIZE;
+
+	const auto solver = std::static_pointer_cast<ISolver>(std::make_shared<ClassicSolver>(depth, variant, evaluationCacheSize));
+	auto game         = std::make_unique<Game>(*firstPlayer, *secondPlayer, solver.get(), isFirst, isHotseat, variant);
 
 	const auto returnCode = game->LaunchGameLoop(result->count("time"));
 
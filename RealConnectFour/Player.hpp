@@ -21,8 +21,10 @@ public:
 		return this->character_;
 	}
 
-	bool MakeMove(Board* board, short move) const {
-		return board->MakeMove(move, this->character_);
+	// `move` is a column to drop into, or BoardType::ToPopMove(column) to pop it.
+	template<class BoardType>
+	bool MakeMove(BoardType* board, short move) const {
+		return board->PlayMove(move, this->character_);
 	}
 
 protected:
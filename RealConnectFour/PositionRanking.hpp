@@ -0,0 +1,144 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+#include "Board.hpp"
+
+// Bijection between positions and the dense range [0, COUNT), for array-indexed position tables.
+// Ranked positions are those of alternating play with PlayerSymbol::FIRST moving first: any column
+// heights, with ceil(n / 2) of the n discs belonging to the first player. Lines completed before the
+// last move are not checked, so positions that only arise after the game was over are ranked too,
+// and ranks do not depend on Connect.
+// A rank is the offset of its column heights (heights in lexicographic order, each weighted by the
+// number of colourings it allows) plus the colex rank of the first player's discs among all discs.
+template<short Rows = 6, short Columns = 7, short Connect = 4>
+class PositionRanking {
+	static_assert((Rows + 1) * Columns <= 64, "Ranking works on positions with a 64-bit exact code.");
+
+	using BoardType = BasicBoard<Rows, Columns, Connect>;
+
+	static constexpr short CELLS = Rows * Columns;
+public:
+	//------------------------------------------------- CTOR SECTION -------------------------------------------------//
+
+	PositionRanking() = delete;
+
+	//-------------------------------------------- ACCESSOR SECTION --------------------------------------------------//
+
+	// BINOMIALS[n][k] = n choose k.
+	static constexpr auto BINOMIALS = [] {
+		std::array<std::array<uint64_t, CELLS + 1>, CELLS + 1> binomials{};
+
+		for (auto n = 0; n <= CELLS; ++n) {
+			binomials[n][0] = 1;
+			for (auto k = 1; k <= n; ++k) {
+				binomials[n][k] = binomials[n - 1][k - 1] + (k < n ? binomials[n - 1][k] : 0);
+			}
+		}
+
+		return binomials;
+	}();
+
+	// SUFFIXES[m][t]: positions that complete a prefix holding t discs with m more columns.
+	static constexpr auto SUFFIXES = [] {
+		std::array<std::array<uint64_t, CELLS + 1>, Columns + 1> suffixes{};
+
+		for (auto t = 0; t <= CELLS; ++t) {
+			suffixes[0][t] = BINOMIALS[t][(t + 1) / 2];
+		}
+
+		for (auto m = 1; m <= Columns; ++m) {
+			for (auto t = 0; t + m * Rows <= CELLS; ++t) {
+				for (auto h = 0; h <= Rows; ++h) {
+					if (suffixes[m][t] > std::numeric_limits<uint64_t>::max() - suffixes[m - 1][t + h]) {
+						throw std::overflow_error("Position count does not fit into 64 bits.");
+					}
+					suffixes[m][t] += suffixes[m - 1][t + h];
+				}
+			}
+		}
+
+		return suffixes;
+	}();
+
+	static constexpr uint64_t COUNT = SUFFIXES[Columns][0];
+
+	//--------------------------------------------- METHOD SECTION ---------------------------------------------------//
+
+	[[nodiscard]] static uint64_t Rank(const BoardType& board) {
+		const auto code = static_cast<uint64_t>(board.ToExactKey());
+
+		auto rank     = uint64_t{ 0 };
+		auto discs    = 0;
+		auto contents = uint64_t{ 0 };
+
+		for (short column = 0; column < Columns; ++column) {
+			const auto columnBits = (code >> column * (Rows + 1)) & ((uint64_t{ 1 } << (Rows + 1)) - 1);
+			const auto height     = std::bit_width(columnBits) - 1;
+
+			for (auto h = 0; h < height; ++h) {
+				rank += SUFFIXES[Columns - 1 - column][discs + h];
+			}
+
+			contents |= (columnBits ^ (uint64_t{ 1 } << height)) << discs;
+			discs    += height;
+		}
+
+		if (std::popcount(contents) != (discs + 1) / 2) {
+			throw std::invalid_argument("Position does not have a first-player-first disc balance.");
+		}
+
+		// Colex rank of the first player's discs among all discs.
+		auto ones = 0;
+		for (; contents != 0; contents &= contents - 1) {
+			rank += BINOMIALS[std::countr_zero(contents)][++ones];
+		}
+
+		return rank;
+	}
+
+	[[nodiscard]] static BoardType Unrank(uint64_t rank) {
+		if (rank >= COUNT) {
+			throw std::out_of_range("Rank exceeds the number of positions.");
+		}
+
+		std::array<int, Columns> heights{};
+		auto discs = 0;
+
+		for (short column = 0; column < Columns; ++column) {
+			while (rank >= SUFFIXES[Columns - 1 - column][discs + heights[column]]) {
+				rank -= SUFFIXES[Columns - 1 - column][discs + heights[column]];
+				++heights[column];
+			}
+			discs += heights[column];
+		}
+
+		auto contents = uint64_t{ 0 };
+		for (auto ones = (discs + 1) / 2; ones > 0; --ones) {
+			auto position = ones - 1;
+			while (BINOMIALS[position + 1][ones] <= rank) {
+				++position;
+			}
+
+			rank     -= BINOMIALS[position][ones];
+			contents |= uint64_t{ 1 } << position;
+		}
+
+		auto code = uint64_t{ 0 };
+		for (short column = 0, offset = 0; column < Columns; offset += heights[column++]) {
+			const auto columnBits = (contents >> offset) & ((uint64_t{ 1 } << heights[column]) - 1);
+			code |= (columnBits | uint64_t{ 1 } << heights[column]) << column * (Rows + 1);
+		}
+
+		BoardType board;
+		if (!BoardType::TryFromExactKey(code, board)) {
+			throw std::logic_error("Unranked position has an invalid code.");
+		}
+
+		return board;
+	}
+};
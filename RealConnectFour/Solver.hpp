@@ -1,48 +1,42 @@
 #pragma once
 
+#include <array>
+#include <bit>
 #include <ranges>
-#include <unordered_map>
+#include <span>
+#include <utility>
 
+#include "Evaluation.hpp"
+#include "EvaluationCache.hpp"
+#include "IncrementalEvaluator.hpp"
 #include "ISolver.hpp"
 #include "TranspositionTable.hpp"
 
-enum PlayerScore : short {
-	PLAYER_FOUR_IN_A_ROW = 10,
-	PLAYER_THREE_IN_A_ROW = 7,
-	PLAYER_TWO_IN_A_ROW = 1,
-	PLAYER_CENTER = 2,
-	PLAYER_NEAR_CENTER = -1,
-	PLAYER_NEAR_EDGE = -1,
-	PLAYER_EDGE = -1
-};
-
-enum OpponentScore : short {
-	OPPONENT_FOUR_IN_A_ROW = -20,
-	OPPONENT_THREE_IN_A_ROW = -9,
-	OPPONENT_TWO_IN_A_ROW = 0,
-	OPPONENT_CENTER = 0,
-	OPPONENT_NEAR_CENTER = 0,
-	OPPONENT_NEAR_EDGE = 0,
-	OPPONENT_EDGE = 0
-};
-
-class ClassicSolver : public ISolver {
+template<short Rows = 6, short Columns = 7, short Connect = 4>
+class BasicClassicSolver : public IBasicSolver<Rows, Columns, Connect> {
+	using BoardType = BasicBoard<Rows, Columns, Connect>;
 public:
-	ClassicSolver() = delete;
-	ClassicSolver(const ClassicSolver&) = default;
-	ClassicSolver(ClassicSolver&&) noexcept = default;
+	BasicClassicSolver() = delete;
+	BasicClassicSolver(const BasicClassicSolver&) = default;
+	BasicClassicSolver(BasicClassicSolver&&) noexcept = default;
 
-	explicit ClassicSolver(const int depth) : depth_(depth) {}
+	explicit BasicClassicSolver(const int depth, const Variant variant = Variant::CLASSIC,
+		const size_t evaluationCacheSize = BasicEvaluationCache<Rows, Columns, Connect>::DEFAULT_SIZE)
+		: cache_(evaluationCacheSize), depth_(depth), variant_(variant) {}
 
-	~ClassicSolver() noexcept override = default;
+	~BasicClassicSolver() noexcept override = default;
 
-	ClassicSolver& operator=(const ClassicSolver&) = default;
-	ClassicSolver& operator=(ClassicSolver&&) noexcept = default;
+	BasicClassicSolver& operator=(const BasicClassicSolver&) = default;
+	BasicClassicSolver& operator=(BasicClassicSolver&&) noexcept = default;
 
 	[[nodiscard]] int GetDepth() const {
 		return this->depth_;
 	}
 
+	[[nodiscard]] Variant GetVariant() const {
+		return this->variant_;
+	}
+
 	void SetDepth(const int depth) {
 		if (this->depth_ == depth) {
 			return;
@@ -51,24 +45,29 @@ public:
 		this->depth_ = depth;
 	}
 
-	[[nodiscard]] short Solve(const Board& board, const std::pair<Player, Player>& players) override {
+	[[nodiscard]] short Solve(const BoardType& board, const std::pair<Player, Player>& players) override {
 		if (board.GetNumberOfMoves() == 0) {
-			return this->columnsOrder.begin()->first;
+			return BasicClassicSolver::COLUMNS_ORDER.begin()->first;
 		}
 		
-		for (const auto& column : this->columnsOrder | std::ranges::views::keys) {
-			if (board.IsWinningMove(column, players.first.GetCharacter())) {
-				return column;
+		// Win at once if possible, otherwise block the opponent's immediate win. In PopOut pops can
+		// win and defend as well, so there only a winning drop is played without a search.
+		for (const auto character : { players.first.GetCharacter(), players.second.GetCharacter() }) {
+			if (character == players.second.GetCharacter() && this->variant_ == Variant::POP_OUT) {
+				break;
 			}
-		}
 
-		for (const auto& column : this->columnsOrder | std::ranges::views::keys) {
-			if (board.IsWinningMove(column, players.second.GetCharacter())) {
-				return column;
+			const auto threats = board.GetPlayableWinningCells(character);
+
+			for (const auto& column : BasicClassicSolver::COLUMNS_ORDER | std::ranges::views::keys) {
+				if (threats & BoardType::GetColumnMask(column)) {
+					return column;
+				}
 			}
 		}
 
-		const auto move = this->PrunedMiniMax(board, players,
+		auto searchBoard = board;
+		const auto move = this->PrunedMiniMax(searchBoard, players,
 			this->depth_, std::numeric_limits<int>::min(), std::numeric_limits<int>::max(), true).second;
 
 		this->table_.Clear();
@@ -77,139 +76,43 @@ public:
 	}
 
 private:
-	const std::unordered_map<short, std::pair<PlayerScore, OpponentScore>> columnsOrder {
-		{3, { PlayerScore::PLAYER_CENTER, OpponentScore::OPPONENT_CENTER }},
-		{2, { PlayerScore::PLAYER_NEAR_CENTER, OpponentScore::OPPONENT_NEAR_CENTER }},
-		{4, { PlayerScore::PLAYER_NEAR_CENTER, OpponentScore::OPPONENT_NEAR_CENTER }},
-		{1, { PlayerScore::PLAYER_NEAR_EDGE, OpponentScore::OPPONENT_NEAR_EDGE }},
-		{5, { PlayerScore::PLAYER_NEAR_EDGE, OpponentScore::OPPONENT_NEAR_EDGE }},
-		{0, { PlayerScore::PLAYER_EDGE, OpponentScore::OPPONENT_EDGE }},
-		{6, { PlayerScore::PLAYER_EDGE, OpponentScore::OPPONENT_EDGE }}
-	};
-	
-	TranspositionTable table_;
-	
-	int depth_;
-	
-	[[nodiscard]] int ScoreBoard(const Board& board, const std::pair<Player, Player>& players) const {
-		auto score = 0;
-
-		// Column position check
-		for (const auto& [column, cost] : this->columnsOrder) {
-			std::vector<char> cols(board.GetRowsCount());
-
-			if (board.TryGetColumn(column, cols.begin())) {
-				score += this->ScoreColumn(cols, players, cost.first, cost.second);
-			}
-		}
-
-		// Horizontal check
-		for (auto i = 0; i < board.GetRowsCount(); ++i) {
-			std::vector<char> rows(board.GetColumnsCount());
-			
-			if (board.TryGetRow(i, rows.begin())) {
-				for (auto j = 0; j < rows.size() - 3; ++j) {
-					score += this->ScoreWindow({ rows.cbegin() + j, rows.cbegin() + j + 4 }, players);
-				}
-			}
-		}
-
-		//// Vertical check
-		for (auto i = 0; i < board.GetColumnsCount(); ++i) {
-			std::vector<char> cols(board.GetRowsCount());
-
-			if (board.TryGetColumn(i, cols.begin())) {
-				for (auto j = 0; j < cols.size() - 3; ++j) {
-					score += this->ScoreWindow({ cols.cbegin() + j, cols.cbegin() + j + 4 }, players);
-				}
-			}
-		}
-
-		// Positive diagonal
-		for (auto i = 0; i < board.GetRowsCount() - 3; ++i) {
-			for (auto j = 0; j < board.GetColumnsCount() - 3; ++j) {
-				std::vector<char> tempDiagonal(4u);
-
-				for (auto k = 0u; k < tempDiagonal.size(); ++k) {
-					tempDiagonal[k] = board.GetCell(i + k, j + k);
-				}
-
-				score += this->ScoreWindow(tempDiagonal, players);
-			}
-		}
-
-		// Negative diagonal
-		for (auto i = 0; i < board.GetRowsCount() - 3; ++i) {
-			for (auto j = 0; j < board.GetColumnsCount() - 3; ++j) {
-				std::vector<char> tempDiagonal(4u);
-				
-				for (auto k = 0; k < 4; ++k) {
-					tempDiagonal[k] = board.GetCell(i - k + 3, j + k);
-				}
+	static constexpr auto COLUMNS_ORDER = evaluation::MakeColumnsOrder<Columns>();
 
-				score += this->ScoreWindow(tempDiagonal, players);
-			}
+	// Drops from the center outwards, then the pops of PopOut in the same order.
+	static constexpr auto MOVES_ORDER = [] {
+		std::array<short, 2 * Columns> moves{};
+		for (short i = 0; i < Columns; ++i) {
+			moves[i]           = COLUMNS_ORDER[i].first;
+			moves[Columns + i] = BoardType::ToPopMove(COLUMNS_ORDER[i].first);
 		}
 
-		return score;
-	}
+		return moves;
+	}();
 
-	[[nodiscard]] int ScoreWindow(const std::vector<char>& window, const std::pair<Player, Player>& players) const {
-		auto score = 0;
+	BasicTranspositionTable<Rows, Columns, Connect> table_;
 
-		const auto countPlayerSymbol
-			= std::ranges::count(std::as_const(window), players.first.GetCharacter());
-		const auto countOpponentSymbol
-			= std::ranges::count(std::as_const(window), players.second.GetCharacter());
-		const auto countBlankSymbol
-			= std::ranges::count(std::as_const(window), ' ');
+	// Follows the search from leaf to leaf; it only re-scores the lines the moves in between touched.
+	IncrementalEvaluator<Rows, Columns, Connect> evaluator_;
 
-		// My influence
-		if (countPlayerSymbol == 4) {
-			score += PlayerScore::PLAYER_FOUR_IN_A_ROW;
-		}
-		else if (countPlayerSymbol == 3 && countBlankSymbol == 1) {
-			score += PlayerScore::PLAYER_THREE_IN_A_ROW;
-		}
-		else if (countPlayerSymbol == 2 && countBlankSymbol == 2) {
-			score += PlayerScore::PLAYER_TWO_IN_A_ROW;
-		}
-
-		// Opponent's influence
-		if (countOpponentSymbol == 4) {
-			score += OpponentScore::OPPONENT_FOUR_IN_A_ROW;
-		}
-		if (countOpponentSymbol == 3 && countBlankSymbol == 1) {
-			score += OpponentScore::OPPONENT_THREE_IN_A_ROW;
-		}
-		else if (countOpponentSymbol == 2 && countBlankSymbol == 2) {
-			score += OpponentScore::OPPONENT_TWO_IN_A_ROW;
-		}
-
-		return score;
-	}
-
-	[[nodiscard]] int ScoreColumn(const std::vector<char>& column, const std::pair<Player, Player>& players,
-		const int playerBonus, const int opponentBonus) const {
-		auto score = 0;
-
-		const auto playerCount =
-			std::ranges::count_if(std::as_const(column), [&players](const auto val) { return val == players.first.GetCharacter(); });
-		const auto opponentCount =
-			std::ranges::count_if(std::as_const(column), [&players](const auto val) { return val == players.second.GetCharacter(); });
-
-		score += playerCount * playerBonus;
-		score += opponentCount * opponentBonus;
+	// Leaf scores by position; unlike table_ it survives between moves, as scores do not depend on depth.
+	BasicEvaluationCache<Rows, Columns, Connect> cache_;
+	
+	int depth_;
+	Variant variant_;
 
-		return score;
+	[[nodiscard]] std::span<const short> GetMovesOrder() const {
+		return std::span(BasicClassicSolver::MOVES_ORDER).first(this->variant_ == Variant::POP_OUT ? 2 * Columns : Columns);
 	}
-
-	[[nodiscard]] std::pair<int, short> PrunedMiniMax(const Board& board, const std::pair<Player, Player>& players,
+	
+	[[nodiscard]] std::pair<int, short> PrunedMiniMax(BoardType& board, const std::pair<Player, Player>& players,
 		int depth, const int alpha, const int beta, const bool isMax) {
 		const auto winCode = board.GetWinnerCharacter();
 		short bestMove = -1;
 
-		depth = board.GetSize() - board.GetNumberOfMoves() <= depth ? board.GetSize() - board.GetNumberOfMoves() : depth;
+		// Only drops fill the board; PopOut games can last longer than the empty cells.
+		if (this->variant_ == Variant::CLASSIC) {
+			depth = board.GetSize() - board.GetNumberOfMoves() <= depth ? board.GetSize() - board.GetNumberOfMoves() : depth;
+		}
 
 		if (winCode == players.first.GetCharacter()) {
 			return { PlayerScore::PLAYER_FOUR_IN_A_ROW * (depth + 1), bestMove };
@@ -218,19 +121,23 @@ private:
 			return { OpponentScore::OPPONENT_FOUR_IN_A_ROW * (depth + 1), bestMove };
 		}
 
-		std::vector<short> availableMoves(board.GetColumnsCount(), -1);
-		board.TryGetAvailableMoves(availableMoves.begin());
-		availableMoves.erase(std::ranges::remove(availableMoves, -1).begin(), availableMoves.cend());
-		availableMoves.shrink_to_fit();
+		const auto playableColumns = board.GetPlayableColumns();
 
-		bestMove = availableMoves.empty() ? bestMove : *(availableMoves.begin() + rand() % availableMoves.size());
+		bestMove = playableColumns == 0 ? bestMove : BasicClassicSolver::PickRandomColumn(playableColumns);
 		
 		if (winCode == ' ') {
 			return { 0, bestMove };
 		}
 
 		if (depth <= 0) {
-			return { this->ScoreBoard(board, players), bestMove };
+			auto score = 0;
+			if (!this->cache_.TryGetScore(board, players.first.GetCharacter(), score)) {
+				this->evaluator_.Sync(board);
+				score = this->evaluator_.GetScore(players.first.GetCharacter());
+				this->cache_.Insert(board, players.first.GetCharacter(), score);
+			}
+
+			return { score, bestMove };
 		}
 
 		Score temp{ .points = -1, .depth = depth, .bestMove = bestMove };
@@ -241,20 +148,27 @@ private:
 		return this->PrunedMiniMaxWrapper(board, players, depth, alpha, beta, isMax);
 	}
 
-	[[nodiscard]] std::pair<int, short> MiniWrapper(const Board& board, const std::pair<Player, Player>& players,
+	[[nodiscard]] static short PickRandomColumn(uint32_t columns) {
+		for (auto skip = rand() % std::popcount(columns); skip > 0; --skip) {
+			columns &= columns - 1;
+		}
+
+		return static_cast<short>(std::countr_zero(columns));
+	}
+
+	[[nodiscard]] std::pair<int, short> MiniWrapper(BoardType& board, const std::pair<Player, Player>& players,
 		int depth, int alpha, int beta) {
 
 		auto [bestScore, bestMove] = std::make_pair(std::numeric_limits<int>::max(), -1);
 		
-		for (const auto& column : this->columnsOrder | std::views::keys) {
-			auto tempBoard = board;
-
-			if (tempBoard.MakeMove(column, players.second.GetCharacter())) {
-				const auto score = this->PrunedMiniMax(tempBoard, players, depth - 1, alpha, beta, true).first;
+		for (const auto move : this->GetMovesOrder()) {
+			if (board.PlayMove(move, players.second.GetCharacter())) {
+				const auto score = this->PrunedMiniMax(board, players, depth - 1, alpha, beta, true).first;
+				board.CancelLastMove();
 
 				if (score < bestScore) {
 					bestScore = score;
-					bestMove = column;
+					bestMove = move;
 				}
 
 				beta = std::min(beta, bestScore);
@@ -268,20 +182,19 @@ private:
 		return std::make_pair(bestScore, bestMove);
 	}
 
-	[[nodiscard]] std::pair<int, short> MaxWrapper(const Board& board, const std::pair<Player, Player>& players,
+	[[nodiscard]] std::pair<int, short> MaxWrapper(BoardType& board, const std::pair<Player, Player>& players,
 		int depth, int alpha, int beta) {
 
 		auto [bestScore, bestMove] = std::make_pair(std::numeric_limits<int>::min(), -1);
 		
-		for (const auto& column : this->columnsOrder | std::views::keys) {
-			auto tempBoard = board;
-
-			if (tempBoard.MakeMove(column, players.first.GetCharacter())) {
-				const auto score = this->PrunedMiniMax(tempBoard, players, depth - 1, alpha, beta, false).first;
+		for (const auto move : this->GetMovesOrder()) {
+			if (board.PlayMove(move, players.first.GetCharacter())) {
+				const auto score = this->PrunedMiniMax(board, players, depth - 1, alpha, beta, false).first;
+				board.CancelLastMove();
 
 				if (score > bestScore) {
 					bestScore = score;
-					bestMove = column;
+					bestMove = move;
 				}
 
 				//if (this->depth_ == depth) {
@@ -303,7 +216,7 @@ private:
 		return std::make_pair(bestScore, bestMove);
 	}
 
-	[[nodiscard]] std::pair<int, short> PrunedMiniMaxWrapper(const Board& board, const std::pair<Player, Player>& players,
+	[[nodiscard]] std::pair<int, short> PrunedMiniMaxWrapper(BoardType& board, const std::pair<Player, Player>& players,
 		int depth, int alpha, int beta, const bool isMax) {
 
 		const auto [bestScore, bestMove] = isMax
@@ -314,22 +227,6 @@ private:
 		
 		return std::make_pair(bestScore, bestMove);
 	}
-
-	[[nodiscard]] short PickBestMove(const Board& board, const std::pair<Player, Player>& players) const {
-		auto maxScore = std::numeric_limits<int>::min();
-		auto bestMove = static_cast<short>(rand() % board.GetColumnsCount());
-
-		for (const auto column : this->columnsOrder | std::views::keys) {
-			auto tempBoard = board;
-			if (tempBoard.MakeMove(column, players.first.GetCharacter())) {
-				const auto score = this->ScoreBoard(tempBoard, players);
-				if (score > maxScore) {
-					maxScore = score;
-					bestMove = column;
-				}
-			}
-		}
-
-		return bestMove;
-	}
 };
+
+using ClassicSolver = BasicClassicSolver<>;
@@ -1,5 +1,10 @@
 #pragma once
-#include <map>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 #include "Board.hpp"
 
@@ -9,64 +14,90 @@ struct Score {
 	short bestMove;
 };
 
-class TranspositionTable {
+// Direct-mapped like BasicEvaluationCache: the canonical key picks one slot of a table allocated
+// once up front, so the search never touches the heap while it stores or looks up nodes.
+template<short Rows = 6, short Columns = 7, short Connect = 4>
+class BasicTranspositionTable {
 	using ScoreType = Score;
-	using Key = uint64_t;
+	using BoardType = BasicBoard<Rows, Columns, Connect>;
+
+	// Slots can collide; the exact position code tells whether the entry is really ours. It is never
+	// zero, so a default entry matches nothing.
+	struct Entry {
+		typename BoardType::Bitboard position;
+		ScoreType score;
+	};
 public:
+	static constexpr size_t DEFAULT_SIZE = size_t{ 1 } << 18;
+
 	//------------------------------------------------- CTOR SECTION -------------------------------------------------//
 
-	explicit TranspositionTable() = default;
-	TranspositionTable(const TranspositionTable&) = default;
-	TranspositionTable(TranspositionTable&&) noexcept = default;
+	// `size` entries rounded down to a power of two, at least one.
+	explicit BasicTranspositionTable(const size_t size = DEFAULT_SIZE)
+		: table_(std::bit_floor(std::max<size_t>(size, 1))) {}
+
+	BasicTranspositionTable(const BasicTranspositionTable&) = default;
+	BasicTranspositionTable(BasicTranspositionTable&&) noexcept = default;
 
 	//----------------------------------------------- DTOR SECTION ---------------------------------------------------//
 
-	~TranspositionTable() noexcept = default;
-	
+	~BasicTranspositionTable() noexcept = default;
+
 	//--------------------------------------------- OPERATOR SECTION -------------------------------------------------//
 
-	TranspositionTable& operator=(const TranspositionTable&) = default;
-	TranspositionTable& operator=(TranspositionTable&&) noexcept = default;
-	
+	BasicTranspositionTable& operator=(const BasicTranspositionTable&) = default;
+	BasicTranspositionTable& operator=(BasicTranspositionTable&&) noexcept = default;
+
 	//-------------------------------------------- ACCESSOR SECTION --------------------------------------------------//
 
-	bool GetScore(const Board& key, ScoreType& valueToSave) const {
-		const auto find = this->table_.find(key.ToKey());
+	[[nodiscard]] size_t GetSize() const {
+		return this->table_.size();
+	}
+
+	bool GetScore(const BoardType& key, ScoreType& valueToSave) const {
+		const auto& entry = this->table_[this->GetSlot(key)];
 
-		if (find == this->table_.cend()) {
+		if (entry.position != key.ToCanonicalExactKey()) {
 			return false;
 		}
 
-		valueToSave = find->second;
+		valueToSave = entry.score;
+		valueToSave.bestMove = BasicTranspositionTable::ToBoardMove(key, valueToSave.bestMove);
 		return true;
 	}
-	
+
 	//--------------------------------------------- METHOD SECTION ---------------------------------------------------//
 
 	void Clear() {
-		this->table_.clear();
+		std::fill(this->table_.begin(), this->table_.end(), Entry{});
 	}
-	
-	void Insert(const Board& key, const ScoreType& value) {
-		const auto keyValue = key.ToKey();
-		const auto find     = this->table_.find(keyValue);
-		if (find != this->table_.cend() && value.depth > find->second.depth) {
-			this->table_.erase(find);
+
+	// Another position in the slot is replaced; the same position only by a deeper search.
+	void Insert(const BoardType& key, const ScoreType& value) {
+		const auto position = key.ToCanonicalExactKey();
+		auto& entry         = this->table_[this->GetSlot(key)];
+		if (entry.position == position && value.depth <= entry.score.depth) {
+			return;
 		}
-		
-		return this->Insert({ keyValue, value });
+
+		auto canonicalValue     = value;
+		canonicalValue.bestMove = BasicTranspositionTable::ToBoardMove(key, value.bestMove);
+
+		entry = { position, canonicalValue };
 	}
 
 private:
-	std::map<Key, ScoreType> table_;
+	std::vector<Entry> table_;
 
-	void Insert(const std::pair<Key, ScoreType>& pair) {
-		//auto element = this->table_.find(pair.first);
-
-		//if (element != this->table_.cend() && element->second.depth >= pair.second.depth) {
-		//	return;
-		//}
+	// Entries of mirrored positions keep their move mirrored; the mapping is its own inverse.
+	[[nodiscard]] static short ToBoardMove(const BoardType& board, const short move) {
+		return board.IsCanonicalMirrored() && move >= 0 ? BoardType::MirrorMove(move) : move;
+	}
 
-		this->table_.insert(pair);
+	// Keys are tabulation hashes, so their low bits are as good as any.
+	[[nodiscard]] size_t GetSlot(const BoardType& board) const {
+		return static_cast<size_t>(board.ToCanonicalKey()) & (this->table_.size() - 1);
 	}
 };
+
+using TranspositionTable = BasicTranspositionTable<>;
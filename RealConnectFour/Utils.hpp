@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <sstream>
 
@@ -15,6 +16,15 @@ namespace utils {
 		return ss.fail() ? -1 : result;
 	}
 
+	// Deterministic pseudo-random generator, usable in constant expressions.
+	constexpr uint64_t SplitMix64(uint64_t& state) {
+		auto result = state += 0x9E3779B97F4A7C15ull;
+		result = (result ^ (result >> 30)) * 0xBF58476D1CE4E5B9ull;
+		result = (result ^ (result >> 27)) * 0x94D049BB133111EBull;
+
+		return result ^ (result >> 31);
+	}
+
 	inline std::string GetDelimiter(const char symbol, const size_t size) {
 		return std::string(size, symbol);
 	}
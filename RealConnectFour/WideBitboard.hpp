@@ -0,0 +1,225 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Bitboard of `Words` 64-bit words, least significant word first, for layouts wider than 64 bits.
+// Supports the integer operators the board relies on, all constexpr, so code written against
+// uint64_t works unchanged; shifting by the full width or more gives zero instead of being undefined.
+template<size_t Words>
+class WideBitboard {
+	static_assert(Words > 1, "Single-word layouts use uint64_t.");
+public:
+	static constexpr int BITS = static_cast<int>(64 * Words);
+
+	//------------------------------------------------- CTOR SECTION -------------------------------------------------//
+
+	constexpr WideBitboard() = default;
+
+	constexpr WideBitboard(const uint64_t value) : words_{ value } {}
+
+	//--------------------------------------------- OPERATOR SECTION -------------------------------------------------//
+
+	constexpr WideBitboard& operator&=(const WideBitboard& other) {
+		for (size_t i = 0; i < Words; ++i) {
+			this->words_[i] &= other.words_[i];
+		}
+
+		return *this;
+	}
+
+	constexpr WideBitboard& operator|=(const WideBitboard& other) {
+		for (size_t i = 0; i < Words; ++i) {
+			this->words_[i] |= other.words_[i];
+		}
+
+		return *this;
+	}
+
+	constexpr WideBitboard& operator^=(const WideBitboard& other) {
+		for (size_t i = 0; i < Words; ++i) {
+			this->words_[i] ^= other.words_[i];
+		}
+
+		return *this;
+	}
+
+	constexpr WideBitboard& operator+=(const WideBitboard& other) {
+		auto carry = uint64_t{ 0 };
+		for (size_t i = 0; i < Words; ++i) {
+			const auto sum = this->words_[i] + other.words_[i];
+			const auto out = static_cast<uint64_t>(sum < this->words_[i]) | static_cast<uint64_t>(sum + carry < sum);
+
+			this->words_[i] = sum + carry;
+			carry = out;
+		}
+
+		return *this;
+	}
+
+	constexpr WideBitboard& operator-=(const WideBitboard& other) {
+		auto borrow = uint64_t{ 0 };
+		for (size_t i = 0; i < Words; ++i) {
+			const auto difference = this->words_[i] - other.words_[i];
+			const auto out = static_cast<uint64_t>(this->words_[i] < other.words_[i]) | static_cast<uint64_t>(difference < borrow);
+
+			this->words_[i] = difference - borrow;
+			borrow = out;
+		}
+
+		return *this;
+	}
+
+	constexpr WideBitboard& operator<<=(const int shift) {
+		const auto wordShift = static_cast<size_t>(shift / 64);
+		const auto bitShift  = shift % 64;
+
+		for (size_t i = Words; i-- > 0;) {
+			auto word = uint64_t{ 0 };
+			if (shift < BITS && i >= wordShift) {
+				word = this->words_[i - wordShift] << bitShift;
+				if (bitShift != 0 && i > wordShift) {
+					word |= this->words_[i - wordShift - 1] >> (64 - bitShift);
+				}
+			}
+			this->words_[i] = word;
+		}
+
+		return *this;
+	}
+
+	constexpr WideBitboard& operator>>=(const int shift) {
+		const auto wordShift = static_cast<size_t>(shift / 64);
+		const auto bitShift  = shift % 64;
+
+		for (size_t i = 0; i < Words; ++i) {
+			auto word = uint64_t{ 0 };
+			if (shift < BITS && i + wordShift < Words) {
+				word = this->words_[i + wordShift] >> bitShift;
+				if (bitShift != 0 && i + wordShift + 1 < Words) {
+					word |= this->words_[i + wordShift + 1] << (64 - bitShift);
+				}
+			}
+			this->words_[i] = word;
+		}
+
+		return *this;
+	}
+
+	friend constexpr WideBitboard operator&(WideBitboard lhs, const WideBitboard& rhs) { return lhs &= rhs; }
+	friend constexpr WideBitboard operator|(WideBitboard lhs, const WideBitboard& rhs) { return lhs |= rhs; }
+	friend constexpr WideBitboard operator^(WideBitboard lhs, const WideBitboard& rhs) { return lhs ^= rhs; }
+	friend constexpr WideBitboard operator+(WideBitboard lhs, const WideBitboard& rhs) { return lhs += rhs; }
+	friend constexpr WideBitboard operator-(WideBitboard lhs, const WideBitboard& rhs) { return lhs -= rhs; }
+	friend constexpr WideBitboard operator<<(WideBitboard lhs, const int shift) { return lhs <<= shift; }
+	friend constexpr WideBitboard operator>>(WideBitboard lhs, const int shift) { return lhs >>= shift; }
+
+	friend constexpr WideBitboard operator~(WideBitboard value) {
+		for (auto& word : value.words_) {
+			word = ~word;
+		}
+
+		return value;
+	}
+
+	friend constexpr bool operator==(const WideBitboard&, const WideBitboard&) = default;
+
+	constexpr explicit operator bool() const {
+		for (const auto word : this->words_) {
+			if (word != 0) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	//-------------------------------------------- ACCESSOR SECTION --------------------------------------------------//
+
+	[[nodiscard]] constexpr uint64_t GetWord(const size_t index) const {
+		return this->words_[index];
+	}
+
+	//--------------------------------------------- METHOD SECTION ---------------------------------------------------//
+
+	[[nodiscard]] constexpr int Popcount() const {
+		auto count = 0;
+		for (const auto word : this->words_) {
+			count += std::popcount(word);
+		}
+
+		return count;
+	}
+
+	// Index of the lowest set bit, BITS for an empty board.
+	[[nodiscard]] constexpr int CountrZero() const {
+		for (size_t i = 0; i < Words; ++i) {
+			if (this->words_[i] != 0) {
+				return static_cast<int>(64 * i) + std::countr_zero(this->words_[i]);
+			}
+		}
+
+		return BITS;
+	}
+
+	// One more than the index of the highest set bit, 0 for an empty board.
+	[[nodiscard]] constexpr int BitWidth() const {
+		for (size_t i = Words; i-- > 0;) {
+			if (this->words_[i] != 0) {
+				return static_cast<int>(64 * i) + static_cast<int>(std::bit_width(this->words_[i]));
+			}
+		}
+
+		return 0;
+	}
+
+private:
+	std::array<uint64_t, Words> words_{};
+};
+
+namespace bitboard {
+	// Narrowest bitboard holding `Bits` bits: a plain uint64_t whenever it fits.
+	template<size_t Bits>
+	using Fitting = std::conditional_t<Bits <= 64, uint64_t, WideBitboard<(Bits + 63) / 64>>;
+
+	// std::popcount, std::countr_zero, std::bit_width and the low word for either kind of bitboard.
+	constexpr int Popcount(const uint64_t value) {
+		return std::popcount(value);
+	}
+
+	constexpr int CountrZero(const uint64_t value) {
+		return std::countr_zero(value);
+	}
+
+	constexpr int BitWidth(const uint64_t value) {
+		return static_cast<int>(std::bit_width(value));
+	}
+
+	// The lowest 64 bits.
+	constexpr uint64_t LowWord(const uint64_t value) {
+		return value;
+	}
+
+	template<size_t Words>
+	constexpr uint64_t LowWord(const WideBitboard<Words>& value) {
+		return value.GetWord(0);
+	}
+
+	template<size_t Words>
+	constexpr int Popcount(const WideBitboard<Words>& value) {
+		return value.Popcount();
+	}
+
+	template<size_t Words>
+	constexpr int CountrZero(const WideBitboard<Words>& value) {
+		return value.CountrZero();
+	}
+
+	template<size_t Words>
+	constexpr int BitWidth(const WideBitboard<Words>& value) {
+		return value.BitWidth();
+	}
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "Board.hpp"
+
+// Every line of `Connect` cells on a Rows x Columns board, generated at compile time.
+// Cells are flat indices (row * Columns + column, row 0 on top); masks use the Board bitboard layout.
+template<short Rows, short Columns, short Connect = 4>
+class WinningLines {
+	using BoardType = BasicBoard<Rows, Columns, Connect>;
+	using Bitboard  = typename BoardType::Bitboard;
+public:
+	using Line = std::array<short, Connect>;
+
+	//------------------------------------------------- CTOR SECTION -------------------------------------------------//
+
+	WinningLines() = delete;
+
+	//-------------------------------------------- ACCESSOR SECTION --------------------------------------------------//
+
+	// Horizontal, vertical and both diagonal lines.
+	static constexpr size_t COUNT = [] {
+		const auto fits = [](const short length) {
+			return length >= Connect ? static_cast<size_t>(length - Connect + 1) : size_t{ 0 };
+		};
+
+		return Rows * fits(Columns) + fits(Rows) * Columns + 2 * fits(Rows) * fits(Columns);
+	}();
+
+	static constexpr std::array<Line, COUNT> CELLS = [] {
+		constexpr std::array<std::pair<short, short>, 4> directions{ { { 0, 1 }, { 1, 0 }, { 1, 1 }, { -1, 1 } } };
+
+		std::array<Line, COUNT> lines{};
+		auto index = size_t{ 0 };
+
+		for (const auto& [rowStep, columnStep] : directions) {
+			for (short row = 0; row < Rows; ++row) {
+				for (short column = 0; column < Columns; ++column) {
+					const auto lastRow    = row + (Connect - 1) * rowStep;
+					const auto lastColumn = column + (Connect - 1) * columnStep;
+
+					if (lastRow < 0 || lastRow >= Rows || lastColumn >= Columns) {
+						continue;
+					}
+
+					for (short k = 0; k < Connect; ++k) {
+						lines[index][k] = static_cast<short>((row + k * rowStep) * Columns + column + k * columnStep);
+					}
+					++index;
+				}
+			}
+		}
+
+		return lines;
+	}();
+
+	static constexpr std::array<Bitboard, COUNT> MASKS = [] {
+		std::array<Bitboard, COUNT> masks{};
+
+		for (size_t i = 0; i < COUNT; ++i) {
+			for (const auto cell : CELLS[i]) {
+				masks[i] |= BoardType::GetCellMask(cell / Columns, cell % Columns);
+			}
+		}
+
+		return masks;
+	}();
+};
@@ -0,0 +1,89 @@
+#define FMT_HEADER_ONLY
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#include "Solver.hpp"
+
+// Every global allocation bumps the counter, so a block that is meant to stay off the heap
+// can be checked by comparing it before and after.
+namespace {
+	size_t allocations = 0;
+}
+
+void* operator new(const size_t size) {
+	++allocations;
+
+	if (auto* pointer = std::malloc(size == 0 ? 1 : size)) {
+		return pointer;
+	}
+
+	throw std::bad_alloc();
+}
+
+void* operator new[](const size_t size) {
+	return ::operator new(size);
+}
+
+void operator delete(void* pointer) noexcept {
+	std::free(pointer);
+}
+
+void operator delete[](void* pointer) noexcept {
+	std::free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept {
+	std::free(pointer);
+}
+
+void operator delete[](void* pointer, size_t) noexcept {
+	std::free(pointer);
+}
+
+// Runs `block` and reports how many allocations it made, which should be none.
+template<class Block>
+bool ExpectNoAllocations(const char* name, Block&& block) {
+	const auto before = allocations;
+	block();
+	const auto count  = allocations - before;
+
+	if (count != 0) {
+		std::cerr << name << ": " << count << " allocations\n";
+		return false;
+	}
+
+	return true;
+}
+
+int main() {
+	const auto board   = Board::FromMoves("4453");
+	const auto players = std::make_pair(Player(PlayerSymbol::FIRST), Player(PlayerSymbol::SECOND));
+
+	// The tables are allocated when a solver is built; searching must not add anything.
+	auto classic = ClassicSolver(8);
+	auto popOut  = ClassicSolver(6, Variant::POP_OUT);
+
+	auto isPassed = true;
+	isPassed &= ExpectNoAllocations("classic search", [&] { static_cast<void>(classic.Solve(board, players)); });
+	isPassed &= ExpectNoAllocations("PopOut search", [&] { static_cast<void>(popOut.Solve(board, players)); });
+
+	// The leaf path on its own: the evaluator follows a game move by move and the cache keeps its scores.
+	auto evaluator = IncrementalEvaluator<>();
+	auto cache     = EvaluationCache(1024);
+
+	isPassed &= ExpectNoAllocations("leaf evaluation", [&] {
+		auto game  = board;
+		auto score = 0;
+
+		for (const auto column : { 2, 2, 3, 1, 0, 6, 5, 4 }) {
+			const auto symbol = game.GetNumberOfMoves() % 2 == 0 ? PlayerSymbol::FIRST : PlayerSymbol::SECOND;
+			if (game.MakeMove(static_cast<short>(column), symbol) && !cache.TryGetScore(game, symbol, score)) {
+				evaluator.Sync(game);
+				cache.Insert(game, symbol, evaluator.GetScore(symbol));
+			}
+		}
+	});
+
+	return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,101 @@
+#define FMT_HEADER_ONLY
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+
+#include "Board.hpp"
+
+bool Expect(const char* name, const bool condition) {
+	if (!condition) {
+		std::cerr << name << ": failed\n";
+	}
+
+	return condition;
+}
+
+bool Parses(const std::string_view moves) {
+	Board board;
+	return Board::TryFromMoves(moves, board);
+}
+
+// Same discs, same keys: everything a pop and its undo must leave as they were.
+template<class BoardType>
+bool IsSamePosition(const BoardType& lhs, const BoardType& rhs) {
+	return lhs.GetDiscs(PlayerSymbol::FIRST) == rhs.GetDiscs(PlayerSymbol::FIRST)
+		&& lhs.GetDiscs(PlayerSymbol::SECOND) == rhs.GetDiscs(PlayerSymbol::SECOND)
+		&& lhs.ToKey() == rhs.ToKey()
+		&& lhs.ToMirrorKey() == rhs.ToMirrorKey();
+}
+
+// Plays random PopOut games. After every pop the incremental keys must equal those of the same
+// position built from scratch, and CancelLastMove must bring back the board and its history.
+template<short Rows, short Columns>
+bool CheckPopRoundTrips(const unsigned seed) {
+	using BoardType = BasicBoard<Rows, Columns>;
+
+	std::mt19937 random(seed);
+	for (auto game = 0; game < 200; ++game) {
+		BoardType board;
+
+		for (auto turn = 0; turn < 4 * Rows * Columns && board.GetWinnerCharacter() == '='; ++turn) {
+			const auto symbol = turn % 2 == 0 ? PlayerSymbol::FIRST : PlayerSymbol::SECOND;
+			const auto column = static_cast<short>(random() % Columns);
+
+			if (random() % 3 != 0 || !board.CanPop(column, symbol)) {
+				static_cast<void>(board.MakeMove(column, symbol));
+				continue;
+			}
+
+			const auto before = board;
+			board.PopMove(column, symbol);
+
+			BoardType scratch;
+			if (!BoardType::TryFromExactKey(board.ToExactKey(), scratch) || !IsSamePosition(board, scratch)) {
+				return false;
+			}
+
+			auto undone = board;
+			undone.CancelLastMove();
+
+			// A full history gives up its oldest record to make room for the pop.
+			auto history = before.GetHistory();
+			if (history.size() == board.GetHistory().size()) {
+				history = history.subspan(1);
+			}
+
+			if (!IsSamePosition(undone, before) || !std::ranges::equal(undone.GetHistory(), history)) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+int main() {
+	auto isPassed = true;
+
+	// Columns past the edge are illegal, not pops: "8" must not be read as "p1" on seven columns.
+	isPassed &= Expect("\"128\" is rejected", !Parses("128"));
+	isPassed &= Expect("\"18\" is rejected", !Parses("18"));
+	isPassed &= Expect("\"11p1\" parses", Parses("11p1"));
+	isPassed &= Expect("\"1 1 p1\" parses", Parses("1 1 p1"));
+	isPassed &= Expect("\"p1\" on an empty board is rejected", !Parses("p1"));
+	isPassed &= Expect("\"1p1\" popping the other side's disc is rejected", !Parses("1p1"));
+
+	// X drops, O drops, X pops: O's disc is left alone at the bottom, as if O had dropped it first.
+	const auto popped  = Board::FromMoves("11p1");
+	const auto dropped = Board::FromMoves("1", PlayerSymbol::SECOND);
+	isPassed &= Expect("a pop matches the position built by drops", IsSamePosition(popped, dropped));
+
+	auto undone = popped;
+	undone.CancelLastMove();
+	isPassed &= Expect("undoing a pop restores the board", IsSamePosition(undone, Board::FromMoves("11")));
+
+	isPassed &= Expect("pop round trips on 6x7", CheckPopRoundTrips<6, 7>(1));
+	isPassed &= Expect("pop round trips on 4x4", CheckPopRoundTrips<4, 4>(2));
+	isPassed &= Expect("pop round trips on 9x7", CheckPopRoundTrips<9, 7>(3));
+
+	return isPassed ? EXIT_SUCCESS : EXIT_FAILURE;
+}